@@ -0,0 +1,82 @@
+/// @file InstantiationSize.cpp
+/// Benchmark of promise machinery instantiated for many result types.
+/// Awaits lazy tasks of `ResultTypeCount` distinct result types in a loop,
+/// so that every await suspends, transfers to the child and is resumed from
+/// its final suspension. Compare the text size printed by the build and the
+/// time per await across changes.
+///
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/LazyTask.h>
+
+// STL
+//
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <utility>
+
+namespace
+{
+
+constexpr std::size_t ResultTypeCount = 64;
+constexpr std::size_t Iterations = 20'000;
+
+/// @brief Distinct result type per index.
+///
+template <std::size_t I>
+struct Payload
+{
+    std::size_t Value = I;
+};
+
+template <std::size_t I>
+Cortado::LazyTask<Payload<I>> Produce()
+{
+    co_return Payload<I>{};
+}
+
+template <std::size_t I>
+Cortado::LazyTask<std::size_t> Consume()
+{
+    Payload<I> payload = co_await Produce<I>();
+    co_return payload.Value;
+}
+
+template <std::size_t... I>
+Cortado::LazyTask<std::size_t> ConsumeAll(std::index_sequence<I...>)
+{
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < Iterations; ++i)
+    {
+        ((sum += co_await Consume<I>()), ...);
+    }
+    co_return sum;
+}
+
+} // namespace
+
+int main()
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    const std::size_t sum =
+        ConsumeAll(std::make_index_sequence<ResultTypeCount>{}).Get();
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+
+    // Two awaits per Consume: of Consume itself and of Produce.
+    //
+    const std::size_t awaits = 2 * ResultTypeCount * Iterations;
+
+    std::cout << "Result types: " << ResultTypeCount << '\n'
+              << "Awaits: " << awaits << '\n'
+              << "ns/await: "
+              << static_cast<double>(elapsed.count()) / awaits << '\n'
+              << "Checksum: " << sum << '\n';
+
+    return 0;
+}
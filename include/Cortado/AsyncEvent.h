@@ -7,7 +7,10 @@
 
 // Cortado
 //
+#include <Cortado/Detail/CancellableAwaiter.h>
 #include <Cortado/Detail/CoroutineAwaiterQueueNode.h>
+#include <Cortado/Detail/CpuRelax.h>
+#include <Cortado/Detail/Throw.h>
 
 // STL
 //
@@ -149,6 +152,52 @@ public:
         }
     }
 
+    /// @brief Remove a waiter from the wait list, e.g. because it was
+    /// cancelled. The list is detached while it is edited and put back
+    /// afterwards.
+    /// @param handleAwaiter Awaiter enqueued by `EnqueueForWait`, or about to
+    /// be.
+    /// @returns `true` if the waiter was removed, `false` if the event was
+    /// set and the waiter is resumed by `Set`.
+    ///
+    bool RemoveWaiter(
+        Detail::CoroutineAwaiterQueueNode *handleAwaiter) noexcept
+    {
+        for (;;)
+        {
+            auto state = m_waitQueue.load(std::memory_order::acquire);
+            if (state == EventSet)
+            {
+                return false;
+            }
+
+            // The waiter may be in a list detached by another remover, or
+            // not enqueued yet.
+            //
+            if (state != EventNotSet &&
+                m_waitQueue.compare_exchange_weak(state,
+                                                  EventNotSet,
+                                                  std::memory_order::acq_rel,
+                                                  std::memory_order::relaxed))
+            {
+                auto *waiters =
+                    reinterpret_cast<Detail::CoroutineAwaiterQueueNode *>(
+                        state);
+                const bool removed =
+                    Detail::UnlinkWaiter(waiters, handleAwaiter);
+
+                PutBack(waiters);
+
+                if (removed)
+                {
+                    return true;
+                }
+            }
+
+            Detail::CpuRelax();
+        }
+    }
+
     /// @brief Sync wait for event.
     /// @tparam AtomicU Is an alias for AtomicT to deduce requirements
     /// only when trying to access Wait method.
@@ -188,6 +237,45 @@ public:
     }
 
 private:
+    /// @brief Return detached waiters to the wait list, or resume them if the
+    /// event was set meanwhile.
+    /// @param waiters Detached list.
+    ///
+    void PutBack(Detail::CoroutineAwaiterQueueNode *waiters) noexcept
+    {
+        if (waiters == nullptr)
+        {
+            return;
+        }
+
+        auto *last = Detail::GetLastWaiter(waiters);
+        auto state = m_waitQueue.load(std::memory_order::acquire);
+        for (;;)
+        {
+            if (state == EventSet)
+            {
+                while (waiters != nullptr)
+                {
+                    auto *next = waiters->Next;
+                    waiters->Resume();
+                    waiters = next;
+                }
+                return;
+            }
+
+            last->Next =
+                reinterpret_cast<Detail::CoroutineAwaiterQueueNode *>(state);
+            if (m_waitQueue.compare_exchange_weak(
+                    state,
+                    reinterpret_cast<Concepts::AtomicPrimitive>(waiters),
+                    std::memory_order::acq_rel,
+                    std::memory_order::acquire))
+            {
+                return;
+            }
+        }
+    }
+
     /// @brief Event not set state constant.
     ///
     static constexpr Concepts::AtomicPrimitive EventNotSet = 0;
@@ -206,7 +294,8 @@ private:
 /// @tparam AtomicT Atomic primitive implementation.
 ///
 template <Concepts::Atomic AtomicT>
-class EventAwaiter : public Detail::CoroutineAwaiterQueueNode
+class EventAwaiter :
+    public Detail::CancellableQueueNode<EventAwaiter<AtomicT>>
 {
 public:
     /// @brief Constructor.
@@ -241,12 +330,18 @@ public:
     }
 
     /// @brief Compiler contract: Enqueue coroutine for resumption when it's
-    /// set.
-    /// @returns true if coroutine enqueued, false if event is ready.
+    /// set. A cancellable coroutine leaves the queue once it is cancelled.
+    /// @returns true if coroutine enqueued, false if event is ready or the
+    /// coroutine is cancelled.
     ///
     template <Cortado::Concepts::TaskImpl T, typename R>
-    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h) noexcept
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
     {
+        if (!this->ArmCancellation(h))
+        {
+            return false;
+        }
+
         AwaiterBase::await_suspend(h);
 
         this->HandleToResume = h;
@@ -254,9 +349,29 @@ public:
         return this->m_event.EnqueueForWait(this);
     }
 
-    using AwaiterBase::await_resume;
+    /// @brief Compiler contract: Resume action.
+    /// @throws OperationStopped if the awaiting coroutine was cancelled.
+    ///
+    void await_resume()
+    {
+        AwaiterBase::await_resume();
+
+        if (this->DisarmCancellation())
+        {
+            Detail::Throw(OperationStopped{});
+        }
+    }
 
 private:
+    friend Detail::CancellableQueueNode<EventAwaiter>;
+
+    /// @brief Cancellation contract: Leave the event's wait list.
+    ///
+    bool RemoveFromWaitList() noexcept
+    {
+        return m_event.RemoveWaiter(this);
+    }
+
     AsyncEvent<AtomicT> &m_event;
 };
 
@@ -7,7 +7,10 @@
 
 // Cortado
 //
+#include <Cortado/Detail/CancellableAwaiter.h>
 #include <Cortado/Detail/CoroutineAwaiterQueueNode.h>
+#include <Cortado/Detail/CpuRelax.h>
+#include <Cortado/Detail/Throw.h>
 
 // STL
 //
@@ -25,6 +28,11 @@ class LockAwaiter;
 template <Concepts::Atomic AtomicT>
 class ScopedLockAwaiter;
 
+/// @brief Forward declaration of awaiters' common code.
+///
+template <Concepts::Atomic AtomicT>
+class LockAwaiterBase;
+
 /// @brief Async mutex implementation. Does not call mutex implementation if
 /// lock cannot be immediately acquired, and puts coroutine asleep.
 /// @tparam AtomicT Atomic primitive implementation.
@@ -33,6 +41,10 @@ template <Concepts::Atomic AtomicT>
 class AsyncMutex
 {
 public:
+    /// @brief Wait list node.
+    ///
+    using WaiterT = Detail::CancellableQueueNode<LockAwaiterBase<AtomicT>>;
+
     /// @brief Default constructor.
     ///
     AsyncMutex() noexcept = default;
@@ -63,8 +75,7 @@ public:
     /// @returns true if enqueued and suspension is rquired.
     /// false if lock is acquired and coroutine is not enqueued.
     ///
-    bool EnqueueForLock(
-        Detail::CoroutineAwaiterQueueNode *handleAwaiter) noexcept
+    bool EnqueueForLock(WaiterT *handleAwaiter) noexcept
     {
         auto expectedState =
             m_lockStateOrQueue.load(std::memory_order::seq_cst);
@@ -110,48 +121,108 @@ public:
     ///
     void Unlock() noexcept
     {
-        // Steal current state, pretending there are no waiters.
-        //
-        auto expectedState =
-            m_lockStateOrQueue.exchange(LockedNoQueue,
-                                        std::memory_order::acquire);
-
-        // If there were really no waiters, just set to unlocked state.
-        //
-        if (expectedState == LockedNoQueue)
+        for (;;)
         {
-            m_lockStateOrQueue.store(NotLocked, std::memory_order::release);
-            return;
-        }
+            // Steal current state, pretending there are no waiters.
+            //
+            auto expectedState =
+                m_lockStateOrQueue.exchange(LockedNoQueue,
+                                            std::memory_order::acq_rel);
+
+            // If there were really no waiters, just set to unlocked state,
+            // unless one has arrived meanwhile.
+            //
+            if (expectedState == LockedNoQueue)
+            {
+                if (m_lockStateOrQueue.compare_exchange_strong(
+                        expectedState,
+                        NotLocked,
+                        std::memory_order::release,
+                        std::memory_order::relaxed))
+                {
+                    return;
+                }
 
-        // Scroll through the list to get the first awaiter.
-        //
-        auto *head = reinterpret_cast<Detail::CoroutineAwaiterQueueNode *>(
-            expectedState);
+                continue;
+            }
 
-        Detail::CoroutineAwaiterQueueNode *prev = nullptr;
-        Detail::CoroutineAwaiterQueueNode *curr = head;
-        while (curr->Next != nullptr)
-        {
-            prev = curr;
-            curr = curr->Next;
-        }
+            // Scroll through the list to get the first awaiter.
+            //
+            auto *head = reinterpret_cast<Detail::CoroutineAwaiterQueueNode *>(
+                expectedState);
 
-        // prev != nullptr means there are more awaiters than one
-        //
-        if (prev != nullptr)
-        {
-            prev->Next = nullptr;
-            m_lockStateOrQueue.store(
-                reinterpret_cast<Concepts::AtomicPrimitive>(head),
-                std::memory_order::release);
+            Detail::CoroutineAwaiterQueueNode *prev = nullptr;
+            Detail::CoroutineAwaiterQueueNode *curr = head;
+            while (curr->Next != nullptr)
+            {
+                prev = curr;
+                curr = curr->Next;
+            }
+
+            // prev != nullptr means there are more awaiters than one
+            //
+            if (prev != nullptr)
+            {
+                prev->Next = nullptr;
+            }
+            else
+            {
+                head = nullptr;
+            }
+
+            static_cast<WaiterT *>(curr)->Grant();
+
+            PutBack(head);
+
+            curr->Resume();
+            return;
         }
-        else
+    }
+
+    /// @brief Remove a waiter from the wait list, e.g. because it was
+    /// cancelled. The list is detached while it is edited and put back
+    /// afterwards.
+    /// @param handleAwaiter Awaiter enqueued by `EnqueueForLock`, or about to
+    /// be.
+    /// @returns true if the waiter was removed, false if it was granted the
+    /// lock.
+    ///
+    bool RemoveWaiter(WaiterT *handleAwaiter) noexcept
+    {
+        for (;;)
         {
-            m_lockStateOrQueue.store(LockedNoQueue, std::memory_order_release);
-        }
+            if (handleAwaiter->IsGranted())
+            {
+                return false;
+            }
+
+            // The waiter may be in a list detached by another remover or by
+            // `Unlock`, or not enqueued yet.
+            //
+            auto state = m_lockStateOrQueue.load(std::memory_order::acquire);
+            if (state != NotLocked && state != LockedNoQueue &&
+                m_lockStateOrQueue.compare_exchange_weak(
+                    state,
+                    LockedNoQueue,
+                    std::memory_order::acq_rel,
+                    std::memory_order::relaxed))
+            {
+                auto *waiters =
+                    reinterpret_cast<Detail::CoroutineAwaiterQueueNode *>(
+                        state);
+                const bool removed =
+                    Detail::UnlinkWaiter(waiters, handleAwaiter);
+
+                PutBack(waiters);
 
-        curr->Resume();
+                if (removed)
+                {
+                    return true;
+                }
+            }
+
+            Detail::CpuRelax();
+        }
     }
 
     /// @brief Get awaitable: co_await mutex.LockAsync();
@@ -185,6 +256,47 @@ public:
     }
 
 private:
+    /// @brief Return detached waiters to the wait list. Waiters that arrived
+    /// meanwhile are newer, so they go in front. If the mutex was unlocked
+    /// meanwhile, it is locked on behalf of the waiters and handed over.
+    /// @param waiters Detached list.
+    ///
+    void PutBack(Detail::CoroutineAwaiterQueueNode *waiters) noexcept
+    {
+        while (waiters != nullptr)
+        {
+            auto state = m_lockStateOrQueue.load(std::memory_order::acquire);
+
+            if (state == NotLocked || state == LockedNoQueue)
+            {
+                if (m_lockStateOrQueue.compare_exchange_weak(
+                        state,
+                        reinterpret_cast<Concepts::AtomicPrimitive>(waiters),
+                        std::memory_order::acq_rel,
+                        std::memory_order::relaxed))
+                {
+                    if (state == NotLocked)
+                    {
+                        Unlock();
+                    }
+                    return;
+                }
+            }
+            else if (m_lockStateOrQueue.compare_exchange_weak(
+                         state,
+                         LockedNoQueue,
+                         std::memory_order::acq_rel,
+                         std::memory_order::relaxed))
+            {
+                auto *newer =
+                    reinterpret_cast<Detail::CoroutineAwaiterQueueNode *>(
+                        state);
+                Detail::GetLastWaiter(newer)->Next = waiters;
+                waiters = newer;
+            }
+        }
+    }
+
     static constexpr auto LockedNoQueue{0};
     static constexpr auto NotLocked{
         (std::numeric_limits<Concepts::AtomicPrimitive>::max)()};
@@ -196,7 +308,8 @@ private:
 /// @tparam AtomicT Atomic primitive implementation.
 ///
 template <Concepts::Atomic AtomicT>
-class LockAwaiterBase : protected Detail::CoroutineAwaiterQueueNode
+class LockAwaiterBase :
+    public Detail::CancellableQueueNode<LockAwaiterBase<AtomicT>>
 {
 protected:
     AsyncMutex<AtomicT> *m_mutex;
@@ -207,6 +320,58 @@ protected:
     LockAwaiterBase(AsyncMutex<AtomicT> *mutex) noexcept : m_mutex{mutex}
     {
     }
+
+    /// @brief Enqueue for lock. A cancellable coroutine leaves the queue
+    /// once it is cancelled.
+    /// @param h Awaiting coroutine.
+    /// @returns true if enqueued, false if locked right away or cancelled.
+    ///
+    template <Concepts::TaskImpl T, typename R>
+    bool Suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
+    {
+        if (!this->ArmCancellation(h))
+        {
+            return false;
+        }
+
+        AwaiterBase::await_suspend(h);
+
+        this->HandleToResume = h;
+
+        if (!m_mutex->EnqueueForLock(this))
+        {
+            // Nothing can cancel the awaiter anymore.
+            //
+            this->Grant();
+            return false;
+        }
+
+        return true;
+    }
+
+    /// @brief Restore AwaiterBase state.
+    /// @throws OperationStopped if the awaiting coroutine was cancelled, in
+    /// which case the lock is not held.
+    ///
+    void OnResume()
+    {
+        AwaiterBase::await_resume();
+
+        if (this->DisarmCancellation())
+        {
+            Detail::Throw(OperationStopped{});
+        }
+    }
+
+private:
+    friend Detail::CancellableQueueNode<LockAwaiterBase>;
+
+    /// @brief Cancellation contract: Leave the mutex's wait list.
+    ///
+    bool RemoveFromWaitList() noexcept
+    {
+        return m_mutex->RemoveWaiter(this);
+    }
 };
 
 /// @brief Awaitable returned by AsyncMutex<AtomicT>::LockAsync()
@@ -256,19 +421,18 @@ public:
     /// @returns true if locked quickly, false otherwise.
     ///
     template <Concepts::TaskImpl T, typename R>
-    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h) noexcept
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
     {
-        AwaiterBase::await_suspend(h);
-
-        this->HandleToResume = h;
-
-        return this->m_mutex->EnqueueForLock(this);
+        return this->Suspend(h);
     }
 
-    /// @brief Compiler contract: Resume action - do nothing, just restore
-    /// AwaiterBase state.
+    /// @brief Compiler contract: Resume action - restore AwaiterBase state.
+    /// @throws OperationStopped if the awaiting coroutine was cancelled.
     ///
-    using AwaiterBase::await_resume;
+    void await_resume()
+    {
+        this->OnResume();
+    }
 };
 
 /// @brief Lightweight RAII guard for use in coroutine functions.
@@ -364,22 +528,18 @@ public:
     /// @returns true if locked quickly, false otherwise.
     ///
     template <Concepts::TaskImpl T, typename R>
-    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h) noexcept
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
     {
-        AwaiterBase::await_suspend(h);
-
-        this->HandleToResume = h;
-
-        return this->m_mutex->EnqueueForLock(this);
+        return this->Suspend(h);
     }
 
     /// @brief Compiler contract: Resume action - restore AwaiterBase state
     /// and return RAII to AsyncMuex.
     ///
     [[nodiscard("Lock will be immeditely released!")]]
-    decltype(auto) await_resume() noexcept
+    decltype(auto) await_resume()
     {
-        AwaiterBase::await_resume();
+        this->OnResume();
         return ScopedLock<AtomicT>{this->m_mutex};
     }
 };
@@ -0,0 +1,203 @@
+/// @file AsyncScope.h
+/// Owner of detached tasks which can be awaited until all of them complete.
+///
+
+#ifndef CORTADO_ASYNC_SCOPE_H
+#define CORTADO_ASYNC_SCOPE_H
+
+// Cortado
+//
+#include <Cortado/AwaiterBase.h>
+#include <Cortado/Concepts/Atomic.h>
+#include <Cortado/Detail/CoroutineAwaiterQueueNode.h>
+#include <Cortado/Task.h>
+
+// STL
+//
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+
+namespace Cortado
+{
+
+/// @brief Structured fire-and-forget. Spawned tasks are detached like dropped
+/// ones, but the scope counts them, so that shutdown can `co_await
+/// scope.Join()` instead of leaking work. The count lives in the scope and
+/// all tasks share a single continuation node of it: spawning allocates
+/// nothing but the coroutine frame.
+/// @tparam AtomicT Atomic primitive implementation.
+///
+template <Concepts::Atomic AtomicT>
+class AsyncScope
+{
+public:
+    class JoinAwaiter;
+
+    /// @brief Constructor.
+    ///
+    AsyncScope() noexcept
+    {
+        m_taskCompleted.HandleToResume = std::noop_coroutine();
+        m_taskCompleted.HandleResumerFunc = &OnTaskCompleted;
+        m_taskCompleted.HandleResumerFuncContext = this;
+    }
+
+    /// @brief Non-copyable.
+    ///
+    AsyncScope(const AsyncScope &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    AsyncScope &operator=(const AsyncScope &) = delete;
+
+    /// @brief Destructor. Spawned tasks must have completed, i.e. the scope
+    /// must be joined first.
+    ///
+    ~AsyncScope()
+    {
+        assert(Outstanding() == 0 && "AsyncScope destroyed before Join");
+    }
+
+    /// @brief Take over a task and let it run to completion on its own.
+    /// Lazy tasks are started on the calling thread.
+    /// @param task Task to detach.
+    ///
+    template <typename R, Concepts::TaskImpl T>
+    void Spawn(Task<R, T> &&task)
+    {
+        static_assert(!Task<R, T>::promise_type::IsShared,
+                      "Shared results have their own awaiters");
+
+        Add(TaskUnit);
+        task.DetachWithContinuation(&m_taskCompleted);
+    }
+
+    /// @brief Get number of spawned tasks that have not completed yet.
+    ///
+    std::size_t Outstanding() const noexcept
+    {
+        return static_cast<std::size_t>(
+            m_state.load(std::memory_order::acquire) / TaskUnit);
+    }
+
+    /// @brief `co_await`-able wait for all spawned tasks. Only one coroutine
+    /// may join at a time, and no task may be spawned meanwhile. The scope
+    /// can be reused after the join.
+    /// @returns Join awaiter.
+    ///
+    JoinAwaiter Join() noexcept
+    {
+        return JoinAwaiter{*this};
+    }
+
+private:
+    // State is 2 * outstanding tasks plus one while nobody is joining, so
+    // whoever brings it to zero - the last task or the joiner - knows the
+    // join is over.
+    //
+    static constexpr Concepts::AtomicPrimitive NotJoining = 1;
+    static constexpr Concepts::AtomicPrimitive TaskUnit = 2;
+
+    /// @brief Atomically add to the state.
+    /// @param delta Value to add.
+    /// @returns New state.
+    ///
+    Concepts::AtomicPrimitive Add(Concepts::AtomicPrimitive delta) noexcept
+    {
+        auto state = m_state.load(std::memory_order::relaxed);
+        while (!m_state.compare_exchange_weak(state,
+                                              state + delta,
+                                              std::memory_order::acq_rel,
+                                              std::memory_order::relaxed))
+        {
+        }
+
+        return state + delta;
+    }
+
+    /// @brief Resumer of the shared continuation node. Runs from final
+    /// suspension of a spawned task, once its frame is freed.
+    /// @returns Joiner if this was the last task, so that it is resumed by
+    /// symmetric transfer.
+    ///
+    static std::coroutine_handle<> OnTaskCompleted(std::coroutine_handle<>,
+                                                   void *context)
+    {
+        auto *_this = static_cast<AsyncScope *>(context);
+
+        // Only the joiner may touch the scope once the state drops to zero.
+        //
+        if (_this->Add(-TaskUnit) == 0)
+        {
+            return _this->m_joiner;
+        }
+
+        return std::noop_coroutine();
+    }
+
+    Detail::CoroutineAwaiterQueueNode m_taskCompleted;
+    std::coroutine_handle<> m_joiner{nullptr};
+    AtomicT m_state{NotJoining};
+};
+
+/// @brief Awaiter which resumes the joining coroutine once all spawned
+/// tasks have completed. The last task resumes it on its own thread.
+/// @tparam AtomicT Atomic primitive implementation.
+///
+template <Concepts::Atomic AtomicT>
+class AsyncScope<AtomicT>::JoinAwaiter : AwaiterBase
+{
+public:
+    /// @brief Constructor.
+    /// @param scope Scope to join.
+    ///
+    explicit JoinAwaiter(AsyncScope &scope) noexcept : m_scope{scope}
+    {
+    }
+
+    /// @brief Compiler contract: Skip suspension if nothing is outstanding.
+    ///
+    bool await_ready() const noexcept
+    {
+        return m_scope.Outstanding() == 0;
+    }
+
+    /// @brief Compiler contract: Publish the joiner and give up the
+    /// not-joining bit.
+    /// @returns false if all tasks completed meanwhile.
+    ///
+    template <Concepts::TaskImpl T, typename R>
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
+    {
+        AwaiterBase::await_suspend(h);
+
+        // The last task may resume the joiner before Add returns.
+        //
+        m_scope.m_joiner = h;
+        m_joined = true;
+
+        return m_scope.Add(-NotJoining) != 0;
+    }
+
+    /// @brief Compiler contract: Reopen the scope for the next join.
+    ///
+    void await_resume()
+    {
+        AwaiterBase::await_resume();
+
+        if (m_joined)
+        {
+            m_scope.m_joiner = nullptr;
+            m_scope.Add(NotJoining);
+        }
+    }
+
+private:
+    AsyncScope &m_scope;
+    bool m_joined = false;
+};
+
+} // namespace Cortado
+
+#endif // CORTADO_ASYNC_SCOPE_H
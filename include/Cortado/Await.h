@@ -8,17 +8,109 @@
 // Cortado
 //
 #include <Cortado/AsyncEvent.h>
+#include <Cortado/CurrentScheduler.h>
 #include <Cortado/Task.h>
 #include <Cortado/Concepts/BackgroundResumable.h>
+#include <Cortado/Concepts/SchedulerAffinity.h>
+#include <Cortado/Detail/AtomicRefCount.h>
+#include <Cortado/Detail/CancellableAwaiter.h>
+#include <Cortado/Detail/Throw.h>
+
+// STL
+//
+#include <exception>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace Cortado
 {
+namespace Detail
+{
+/// @brief Common code of task-to-task awaiters: the awaiter itself is the
+/// continuation node which the awaited task resumes on completion.
+///
+struct TaskContinuationAwaiter : CoroutineAwaiterQueueNode
+{
+protected:
+    /// @brief Register awaiting coroutine as continuation of awaited one.
+    /// If awaiting coroutine has scheduler affinity and runs on a scheduler,
+    /// it is rescheduled there should the awaited task complete elsewhere.
+    /// A lazy awaited coroutine is started right here by symmetric transfer,
+    /// with the continuation already in place.
+    /// @param h Awaiting coroutine.
+    /// @param awaited Promise of awaited coroutine.
+    /// @returns For eager awaited coroutines: true if awaiting coroutine
+    /// stays suspended, false if awaited one has already completed. For lazy
+    /// ones: coroutine to transfer to.
+    ///
+    template <Concepts::TaskImpl T, typename R, typename AwaitedPromiseT>
+    auto SuspendOn(std::coroutine_handle<PromiseType<T, R>> h,
+                   AwaitedPromiseT &awaited)
+    {
+        AwaiterBase::await_suspend(h);
+
+        return SuspendOn<T>(
+            h,
+            awaited,
+            std::coroutine_handle<AwaitedPromiseT>::from_promise(awaited));
+    }
+
+private:
+    /// @brief Result type independent part of `SuspendOn`, instantiated once
+    /// per pair of TaskImpls.
+    /// @param h Awaiting coroutine.
+    /// @param awaited Promise of awaited coroutine.
+    /// @param awaitedHandle Awaited coroutine, started here if it is lazy.
+    ///
+    template <Concepts::TaskImpl T, Concepts::TaskImpl AwaitedT>
+    auto SuspendOn(std::coroutine_handle<> h,
+                   CoroutinePromiseStateBase<AwaitedT> &awaited,
+                   std::coroutine_handle<> awaitedHandle)
+    {
+        this->HandleToResume = h;
+
+        if constexpr (Concepts::SchedulerAffinity<T>)
+        {
+            m_originalScheduler = CurrentScheduler::Get();
+            if (m_originalScheduler)
+            {
+                this->HandleResumerFunc = ResumeOnScheduler;
+                this->HandleResumerFuncContext = &m_originalScheduler;
+            }
+        }
+
+        if constexpr (CoroutinePromiseStateBase<AwaitedT>::IsLazy)
+        {
+            if (awaited.TryStart())
+            {
+                awaited.SetContinuationBeforeStart(this);
+                return awaitedHandle;
+            }
+
+            return awaited.SetContinuation(this)
+                       ? std::coroutine_handle<>{std::noop_coroutine()}
+                       : h;
+        }
+        else
+        {
+            return awaited.SetContinuation(this);
+        }
+    }
+
+    SchedulerRef m_originalScheduler;
+};
+} // namespace Detail
+
 /// @brief Task-to-task awaiter implementation.
 /// @tparam R Return value type of coroutine that awaits.
 /// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
 ///
 template <typename R, Concepts::TaskImpl T>
-struct Task<R, T>::TaskAwaiter : AwaiterBase
+struct Task<R, T>::TaskAwaiter : Detail::TaskContinuationAwaiter
 {
     /// @brief Constructor. Saving a task that we are going to resume.
     /// @param task The task to resume.
@@ -39,10 +131,9 @@ struct Task<R, T>::TaskAwaiter : AwaiterBase
     /// ready.
     ///
     template <Concepts::TaskImpl T2, typename R2>
-    void await_suspend(std::coroutine_handle<Detail::PromiseType<T2, R2>> h)
+    auto await_suspend(std::coroutine_handle<Detail::PromiseType<T2, R2>> h)
     {
-        Base::await_suspend(h);
-        m_awaitedTask.m_handle.promise().SetContinuation(h);
+        return SuspendOn(h, m_awaitedTask.m_handle.promise());
     }
 
     /// @brief Compiler contract: Resume action - take co_await's target result.
@@ -50,7 +141,10 @@ struct Task<R, T>::TaskAwaiter : AwaiterBase
     R await_resume()
     {
         Base::await_resume();
-        return m_awaitedTask.Get();
+
+        // Awaited task is completed by now, no need to wait.
+        //
+        return m_awaitedTask.m_handle.promise().Get();
     }
 
 private:
@@ -69,13 +163,169 @@ inline auto operator co_await(Task<R, T> &&rvalue)
     return typename Task<R, T>::TaskAwaiter{std::forward<Task<R, T>>(rvalue)};
 }
 
+namespace Detail
+{
+/// @brief Call a continuation with the result of a task.
+/// @tparam R Task result type.
+/// @param fn Continuation.
+/// @param getResult Callable which returns the result or rethrows.
+/// @returns What `fn` returns.
+///
+template <typename R, typename F, typename GetResultT>
+decltype(auto) InvokeWithResult(F &fn, GetResultT &&getResult)
+{
+    if constexpr (std::is_void_v<R>)
+    {
+        getResult();
+        return std::invoke(fn);
+    }
+    else
+    {
+        return std::invoke(fn, getResult());
+    }
+}
+} // namespace Detail
+
+/// @brief Task with post-processing attached by `Task::Then`. It owns the
+/// task and the callable; awaiting it awaits the task and calls the
+/// callable in `await_resume`, so no extra frame or promise is created. An
+/// error of the task is rethrown and the callable is skipped.
+/// @tparam R Result type of the task.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+/// @tparam F Callable type.
+///
+template <typename R, Concepts::TaskImpl T, typename F>
+class MappedTask
+{
+public:
+    struct Awaiter;
+
+    /// @brief Constructor.
+    /// @param task Task to take over.
+    /// @param fn Continuation.
+    ///
+    MappedTask(Task<R, T> &&task, F fn) :
+        m_task{std::move(task)},
+        m_fn{std::move(fn)}
+    {
+    }
+
+    /// @brief Test if the task is completed.
+    ///
+    bool IsReady() const
+    {
+        return m_task.IsReady();
+    }
+
+    /// @brief Wait for the task and apply the continuation.
+    /// @returns Continuation result.
+    /// @throws Exception of the task if present.
+    ///
+    decltype(auto) Get()
+        requires Concepts::HasEvent<T>
+    {
+        return Detail::InvokeWithResult<R>(
+            m_fn,
+            [this]() -> decltype(auto) { return m_task.Get(); });
+    }
+
+    /// @brief Attach one more continuation, which receives the result of
+    /// the previous one.
+    /// @param next Callable.
+    /// @returns Mapped task with both continuations.
+    ///
+    template <typename G>
+    auto Then(G &&next) &&
+    {
+        auto composed = [fn = std::move(m_fn),
+                         next = std::forward<G>(next)](auto &&...result) mutable
+            -> decltype(auto)
+        {
+            using ResultT =
+                std::invoke_result_t<F &, decltype(result)...>;
+
+            if constexpr (std::is_void_v<ResultT>)
+            {
+                std::invoke(fn, std::forward<decltype(result)>(result)...);
+                return std::invoke(next);
+            }
+            else
+            {
+                return std::invoke(
+                    next,
+                    std::invoke(fn,
+                                std::forward<decltype(result)>(result)...));
+            }
+        };
+
+        return MappedTask<R, T, decltype(composed)>{std::move(m_task),
+                                                    std::move(composed)};
+    }
+
+private:
+    Task<R, T> m_task;
+    F m_fn;
+};
+
+/// @brief Mapped task awaiter: task awaiter plus the continuation.
+/// @tparam R Result type of the task.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+/// @tparam F Callable type.
+///
+template <typename R, Concepts::TaskImpl T, typename F>
+struct MappedTask<R, T, F>::Awaiter : Task<R, T>::TaskAwaiter
+{
+    /// @brief Constructor. Takes over the task and the continuation.
+    /// @param mapped Mapped task.
+    ///
+    Awaiter(MappedTask &&mapped) :
+        Task<R, T>::TaskAwaiter{std::move(mapped.m_task)},
+        m_fn{std::move(mapped.m_fn)}
+    {
+    }
+
+    /// @brief Compiler contract: Take the result and apply continuation.
+    ///
+    decltype(auto) await_resume()
+    {
+        return Detail::InvokeWithResult<R>(
+            m_fn,
+            [this]() -> decltype(auto)
+            { return Task<R, T>::TaskAwaiter::await_resume(); });
+    }
+
+private:
+    F m_fn;
+};
+
+/// @brief Compiler contract: co_await operator implementation for mapped
+/// tasks.
+/// @tparam R Result type of the task.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+/// @tparam F Callable type.
+/// @returns MappedTask awaiter.
+///
+template <typename R, Concepts::TaskImpl T, typename F>
+inline auto operator co_await(MappedTask<R, T, F> &&mapped)
+{
+    return typename MappedTask<R, T, F>::Awaiter{std::move(mapped)};
+}
+
+template <typename R, Concepts::TaskImpl T>
+template <typename F>
+MappedTask<R, T, std::decay_t<F>> Task<R, T>::Then(F &&fn) &&
+{
+    return MappedTask<R, T, std::decay_t<F>>{std::move(*this),
+                                             std::forward<F>(fn)};
+}
+
 /// @brief Task-to-task awaiter implementation which only awaits completion
 /// without taking result.
 /// @tparam R Return value type of coroutine that awaits.
 /// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
 ///
 template <typename R, Concepts::TaskImpl T>
-struct Task<R, T>::TaskLValueAwaier : AwaiterBase
+struct Task<R, T>::TaskLValueAwaier : Detail::TaskContinuationAwaiter
 {
     /// @brief Constructor. Saving a task that we are going to resume.
     /// @param task The task to resume.
@@ -95,10 +345,9 @@ struct Task<R, T>::TaskLValueAwaier : AwaiterBase
     /// ready.
     ///
     template <Concepts::TaskImpl T2, typename R2>
-    void await_suspend(std::coroutine_handle<Detail::PromiseType<T2, R2>> h)
+    auto await_suspend(std::coroutine_handle<Detail::PromiseType<T2, R2>> h)
     {
-        Base::await_suspend(h);
-        m_awaitedTask.m_handle.promise().SetContinuation(h);
+        return SuspendOn(h, m_awaitedTask.m_handle.promise());
     }
 
     /// @brief Compiler contract: Resume action - do nothing, just restore
@@ -138,17 +387,31 @@ struct ResumeBackgroundAwaiter : AwaiterBase
     /// scheduler.
     ///
     template <Concepts::BackgroundResumable T, typename R>
-    void await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
     {
+        if (!m_cancellation.Capture(h))
+        {
+            return false;
+        }
+
         Base::await_suspend(h);
 
+        [[maybe_unused]] auto handOff = h.promise().HandOver();
         T::GetDefaultBackgroundScheduler().Schedule(h);
+        return true;
     }
 
-    /// @brief Compiler contract: Resume action - do nothing, just restore
-    /// AwaiterBase state.
+    /// @brief Compiler contract: Resume action - restore AwaiterBase state.
+    /// @throws OperationStopped if the awaiting coroutine was cancelled.
     ///
-    using Base::await_resume;
+    void await_resume()
+    {
+        Base::await_resume();
+        m_cancellation.ThrowIfCancelled();
+    }
+
+private:
+    Detail::CancellationCheck m_cancellation;
 };
 
 /// @brief co_await shortcut for resuming on a different thread.
@@ -218,20 +481,32 @@ struct CoroutineSchedulerAwaiter : AwaiterBase
     /// scheduler.
     ///
     template <Concepts::TaskImpl TTask, typename R>
-    void await_suspend(std::coroutine_handle<Detail::PromiseType<TTask, R>> h)
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<TTask, R>> h)
     {
+        if (!m_cancellation.Capture(h))
+        {
+            return false;
+        }
+
         Base::await_suspend(h);
 
+        [[maybe_unused]] auto handOff = h.promise().HandOver();
         m_scheduler.Schedule(h);
+        return true;
     }
 
-    /// @brief Compiler contract: Resume action - do nothing, just restore
-    /// AwaiterBase state.
+    /// @brief Compiler contract: Resume action - restore AwaiterBase state.
+    /// @throws OperationStopped if the awaiting coroutine was cancelled.
     ///
-    using AwaiterBase::await_resume;
+    void await_resume()
+    {
+        AwaiterBase::await_resume();
+        m_cancellation.ThrowIfCancelled();
+    }
 
 private:
     T &m_scheduler;
+    Detail::CancellationCheck m_cancellation;
 };
 
 /// @brief co_await implementation to transfer on specific scheduler.
@@ -245,6 +520,161 @@ inline auto operator co_await(T &sched)
     return CoroutineSchedulerAwaiter{sched};
 };
 
+/// @brief Awaiter that runs a callable on a scheduler and resumes the
+/// awaiting coroutine with its result. The callable, its arguments and the
+/// result slot live in the awaiter, i.e. in the awaiting coroutine's frame.
+/// A posting scheduler runs the call as a plain job that fits its queue
+/// slot; other schedulers resume the awaiting coroutine on the worker and
+/// the call is made there.
+/// @tparam SchedulerT @link Cortado::Concepts::CoroutineScheduler
+/// CoroutineScheduler@endlink.
+/// @tparam F Callable type.
+/// @tparam Args Argument types, stored by value.
+///
+template <Concepts::CoroutineScheduler SchedulerT, typename F, typename... Args>
+struct InvokeAwaiter : AwaiterBase
+{
+    /// @brief Result of the call, returned by value.
+    ///
+    using ResultT = std::decay_t<std::invoke_result_t<F, Args...>>;
+
+    /// @brief Constructor.
+    /// @param sched Scheduler to run the callable on.
+    /// @param fn Callable.
+    /// @param args Arguments.
+    ///
+    template <typename Fn, typename... ArgsT>
+    InvokeAwaiter(SchedulerT &sched, Fn &&fn, ArgsT &&...args) :
+        m_scheduler{sched},
+        m_fn{std::forward<Fn>(fn)},
+        m_args{std::forward<ArgsT>(args)...}
+    {
+    }
+
+    /// @brief Compiler contract: The call always goes to the scheduler.
+    ///
+    bool await_ready()
+    {
+        return false;
+    }
+
+    /// @brief Compiler contract: Hand the call, or the awaiting coroutine,
+    /// over to the scheduler.
+    ///
+    template <Concepts::TaskImpl TTask, typename R>
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<TTask, R>> h)
+    {
+        if (!m_cancellation.Capture(h))
+        {
+            return false;
+        }
+
+        Base::await_suspend(h);
+
+        [[maybe_unused]] auto handOff = h.promise().HandOver();
+
+        if constexpr (Concepts::PostingScheduler<SchedulerT>)
+        {
+            m_scheduler.Post(
+                [this, h]
+                {
+                    Call();
+                    h.resume();
+                });
+        }
+        else
+        {
+            m_scheduler.Schedule(h);
+        }
+
+        return true;
+    }
+
+    /// @brief Compiler contract: Take the result of the call.
+    /// @returns Result of the callable.
+    /// @throws Exception thrown by the callable.
+    /// @throws OperationStopped if the awaiting coroutine was cancelled.
+    ///
+    ResultT await_resume()
+    {
+        AwaiterBase::await_resume();
+        m_cancellation.ThrowIfCancelled();
+
+        if constexpr (!Concepts::PostingScheduler<SchedulerT>)
+        {
+            Call();
+        }
+
+#if CORTADO_HAS_EXCEPTIONS
+        if (m_error)
+        {
+            std::rethrow_exception(std::move(m_error));
+        }
+#endif
+
+        if constexpr (!std::is_void_v<ResultT>)
+        {
+            return std::move(*m_result);
+        }
+    }
+
+private:
+    using ResultSlotT = std::conditional_t<std::is_void_v<ResultT>,
+                                           std::monostate,
+                                           std::optional<ResultT>>;
+
+    /// @brief Make the call and keep its outcome.
+    ///
+    void Call()
+    {
+#if CORTADO_HAS_EXCEPTIONS
+        try
+        {
+#endif
+            if constexpr (std::is_void_v<ResultT>)
+            {
+                std::apply(std::move(m_fn), std::move(m_args));
+            }
+            else
+            {
+                m_result.emplace(
+                    std::apply(std::move(m_fn), std::move(m_args)));
+            }
+#if CORTADO_HAS_EXCEPTIONS
+        }
+        catch (...)
+        {
+            m_error = std::current_exception();
+        }
+#endif
+    }
+
+    SchedulerT &m_scheduler;
+    F m_fn;
+    std::tuple<Args...> m_args;
+    [[no_unique_address]] ResultSlotT m_result;
+#if CORTADO_HAS_EXCEPTIONS
+    std::exception_ptr m_error;
+#endif
+    Detail::CancellationCheck m_cancellation;
+};
+
+/// @brief Run a callable on a scheduler without a coroutine frame:
+/// `auto r = co_await Invoke(pool, fn, args...);`.
+/// @param sched Scheduler to run the callable on.
+/// @param fn Callable.
+/// @param args Arguments, copied or moved into the awaiter.
+/// @returns InvokeAwaiter.
+///
+template <Concepts::CoroutineScheduler SchedulerT, typename F, typename... Args>
+inline auto Invoke(SchedulerT &sched, F &&fn, Args &&...args)
+{
+    return InvokeAwaiter<SchedulerT, std::decay_t<F>, std::decay_t<Args>...>{
+        sched,
+        std::forward<F>(fn),
+        std::forward<Args>(args)...};
+}
+
 /// @brief Await for any task to complete.
 /// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
 /// @tparam R Return value type of coroutine that awaits.
@@ -328,6 +758,33 @@ inline Task<void, T> WhenAny(Task<R, T> &first, Args &...next)
     return WhenAny(AllocatorT{}, first, next...);
 }
 
+/// @brief Get the awaiter `co_await` would use for an operand: the result
+/// of its member or free `operator co_await`, or the operand itself. Meant
+/// for `AwaitTransform` policies that wrap awaiters.
+/// @param awaitable Operand of `co_await`.
+/// @returns Awaiter, by reference if the operand is the awaiter itself.
+///
+template <typename U>
+decltype(auto) GetAwaiter(U &&awaitable)
+{
+    if constexpr (requires {
+                      static_cast<U &&>(awaitable).operator co_await();
+                  })
+    {
+        return static_cast<U &&>(awaitable).operator co_await();
+    }
+    else if constexpr (requires {
+                           operator co_await(static_cast<U &&>(awaitable));
+                       })
+    {
+        return operator co_await(static_cast<U &&>(awaitable));
+    }
+    else
+    {
+        return static_cast<U &&>(awaitable);
+    }
+}
+
 } // namespace Cortado
 
 #endif
\ No newline at end of file
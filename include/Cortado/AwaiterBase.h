@@ -7,7 +7,22 @@
 
 // Cortado
 //
-#include <Cortado/Detail/PromiseType.h>
+#include <Cortado/Concepts/AsyncStackTracing.h>
+#include <Cortado/Concepts/PreAndPostAction.h>
+#include <Cortado/Concepts/TaskImpl.h>
+
+// STL
+//
+#include <coroutine>
+
+namespace Cortado::Detail
+{
+template <Concepts::TaskImpl T, typename R>
+struct PromiseType;
+
+template <Concepts::TaskImpl T>
+struct CoroutinePromiseStateBase;
+} // namespace Cortado::Detail
 
 namespace Cortado
 {
@@ -29,9 +44,11 @@ protected:
         if constexpr (Concepts::HasAdditionalStorage<T> ||
                       Concepts::AsyncStackTracing<T>)
         {
-            m_handle = h;
-            m_beforeResumeFunc = BeforeResumeFunc<T, R>;
-            h.promise().BeforeSuspend();
+            Detail::CoroutinePromiseStateBase<T> &promise = h.promise();
+
+            m_promise = &promise;
+            m_beforeResumeFunc = BeforeResumeFunc<T>;
+            promise.BeforeSuspend();
         }
     }
 
@@ -40,35 +57,30 @@ protected:
     ///
     inline void await_resume()
     {
-        if (m_handle)
+        if (m_promise)
         {
-            m_beforeResumeFunc(m_handle);
+            m_beforeResumeFunc(m_promise);
         }
     }
 
 private:
     /// @brief Type-eraser for awaiters to call before resumption.
     ///
-    using BeforeResumeFuncT = void (*)(std::coroutine_handle<>);
+    using BeforeResumeFuncT = void (*)(void *);
 
-    std::coroutine_handle<> m_handle{nullptr};
+    void *m_promise{nullptr};
     BeforeResumeFuncT m_beforeResumeFunc{nullptr};
 
     /// @brief Type-erased function for awaiters to call before resumption.
+    /// Depends on the TaskImpl only, so coroutines with different result
+    /// types share it.
     /// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
-    /// @tparam R Return type of coroutine.
     ///
-    template <Concepts::TaskImpl T, typename R>
-    static void BeforeResumeFunc(std::coroutine_handle<> h)
+    template <Concepts::TaskImpl T>
+    static void BeforeResumeFunc(void *promise)
     {
-        if constexpr (Concepts::HasAdditionalStorage<T> ||
-                      Concepts::AsyncStackTracing<T>)
-        {
-            auto restored =
-                std::coroutine_handle<Detail::PromiseType<T, R>>::from_address(
-                    h.address());
-            restored.promise().BeforeResume();
-        }
+        static_cast<Detail::CoroutinePromiseStateBase<T> *>(promise)
+            ->BeforeResume();
     }
 };
 } // namespace Cortado
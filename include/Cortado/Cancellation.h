@@ -0,0 +1,129 @@
+/// @file Cancellation.h
+/// Cooperative cancellation of coroutine trees.
+///
+
+#ifndef CORTADO_CANCELLATION_H
+#define CORTADO_CANCELLATION_H
+
+// Cortado
+//
+#include <Cortado/Detail/Throw.h>
+#include <Cortado/OperationStopped.h>
+
+// STL
+//
+#include <stop_token>
+#include <utility>
+
+namespace Cortado
+{
+
+/// @brief Owner side of cancellation. `request_stop()` cancels every
+/// coroutine that was created under one of its tokens.
+///
+using CancellationSource = std::stop_source;
+
+/// @brief Observer side of cancellation.
+///
+using CancellationToken = std::stop_token;
+
+/// @brief Thread-local storage of the cancellation token of currently
+/// running code. Holds a non-owning pointer: the owner is a running
+/// coroutine or a @link Cortado::CancellationScope CancellationScope
+/// @endlink, so switching tokens costs a pointer store and no reference
+/// counting.
+///
+struct CancellationTLS
+{
+    /// @brief Get token of the current thread.
+    /// @returns Token, nullptr if nothing can cancel current code.
+    ///
+    inline static const CancellationToken *Get()
+    {
+        return GetImpl();
+    }
+
+    /// @brief Set token of the current thread.
+    /// @param token Token.
+    ///
+    inline static void Set(const CancellationToken *token)
+    {
+        GetImpl() = token;
+    }
+
+    /// @brief Set token of the current thread.
+    /// @param token Token.
+    /// @returns Token the thread had before.
+    ///
+    inline static const CancellationToken *Exchange(
+        const CancellationToken *token)
+    {
+        return std::exchange(GetImpl(), token);
+    }
+
+private:
+    static const CancellationToken *&GetImpl()
+    {
+        static thread_local const CancellationToken *current = nullptr;
+        return current;
+    }
+};
+
+/// @brief RAII helper which makes all coroutines created in its scope
+/// cancellable by the given token.
+///
+class CancellationScope
+{
+public:
+    /// @brief Constructor. Switches current thread to the token.
+    /// @param token Cancellation token.
+    ///
+    explicit CancellationScope(CancellationToken token) :
+        m_token{std::move(token)},
+        m_previous{CancellationTLS::Exchange(&m_token)}
+    {
+    }
+
+    /// @brief Non-copyable.
+    ///
+    CancellationScope(const CancellationScope &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    CancellationScope &operator=(const CancellationScope &) = delete;
+
+    /// @brief Destructor. Restores previous token.
+    ///
+    ~CancellationScope()
+    {
+        CancellationTLS::Set(m_previous);
+    }
+
+private:
+    CancellationToken m_token;
+    const CancellationToken *m_previous;
+};
+
+/// @brief Check if currently running code was cancelled. Meant for long
+/// stretches of synchronous work inside cancellable coroutines.
+/// @returns true if cancellation is requested.
+///
+inline bool IsCancellationRequested()
+{
+    const CancellationToken *token = CancellationTLS::Get();
+    return token != nullptr && token->stop_requested();
+}
+
+/// @brief Throw `OperationStopped` if currently running code was cancelled.
+///
+inline void ThrowIfCancellationRequested()
+{
+    if (IsCancellationRequested())
+    {
+        Detail::Throw(OperationStopped{});
+    }
+}
+
+} // namespace Cortado
+
+#endif // CORTADO_CANCELLATION_H
@@ -0,0 +1,128 @@
+/// @file AwaitObserver.h
+/// AwaitTransform policy which observes every co_await of a coroutine.
+///
+
+#ifndef CORTADO_COMMON_AWAIT_OBSERVER_H
+#define CORTADO_COMMON_AWAIT_OBSERVER_H
+
+// Cortado
+//
+#include <Cortado/Await.h>
+
+// STL
+//
+#include <coroutine>
+#include <type_traits>
+#include <utility>
+
+namespace Cortado::Common
+{
+
+/// @brief Awaiter which wraps the awaiter of a `co_await` operand and
+/// reports its progress to an observer.
+/// @tparam AwaiterT Wrapped awaiter, a reference if the operand is an
+/// awaiter itself.
+/// @tparam ObserverT Observer type, see @link Cortado::Common::ObservedAwaits
+/// ObservedAwaits@endlink.
+///
+template <typename AwaiterT, typename ObserverT>
+class ObservedAwaiter
+{
+public:
+    /// @brief Constructor. Starts observation.
+    /// @param awaitable Operand of `co_await`.
+    ///
+    template <typename U>
+    explicit ObservedAwaiter(U &&awaitable) :
+        m_awaiter{GetAwaiter(std::forward<U>(awaitable))}
+    {
+    }
+
+    /// @brief Compiler contract: Delegate to the wrapped awaiter.
+    ///
+    bool await_ready()
+    {
+        return Inner().await_ready();
+    }
+
+    /// @brief Compiler contract: Report suspension and delegate to the
+    /// wrapped awaiter. The observer is not touched afterwards, as the
+    /// coroutine may already be running elsewhere.
+    ///
+    template <typename PromiseT>
+    decltype(auto) await_suspend(std::coroutine_handle<PromiseT> h)
+    {
+        if constexpr (requires { m_observer.OnSuspend(); })
+        {
+            m_observer.OnSuspend();
+        }
+
+        return Inner().await_suspend(h);
+    }
+
+    /// @brief Compiler contract: Take the result of the wrapped awaiter and
+    /// report resumption. If the observer throws, the result is destroyed.
+    ///
+    decltype(auto) await_resume()
+    {
+        using ResultT = decltype(Inner().await_resume());
+
+        if constexpr (std::is_void_v<ResultT>)
+        {
+            Inner().await_resume();
+            m_observer.OnResume();
+        }
+        else if constexpr (std::is_reference_v<ResultT>)
+        {
+            ResultT result = Inner().await_resume();
+            m_observer.OnResume();
+            return static_cast<ResultT>(result);
+        }
+        else
+        {
+            ResultT result = Inner().await_resume();
+            m_observer.OnResume();
+            return result;
+        }
+    }
+
+private:
+    std::remove_reference_t<AwaiterT> &Inner() noexcept
+    {
+        return m_awaiter;
+    }
+
+    AwaiterT m_awaiter;
+    ObserverT m_observer;
+};
+
+/// @brief AwaitTransform policy which wraps every `co_await` of a coroutine
+/// into an @link Cortado::Common::ObservedAwaiter ObservedAwaiter@endlink.
+/// Mix into a TaskImpl to time awaits, charge a cooperative budget or check
+/// cancellation at each of them. Coroutines of TaskImpls without the policy
+/// pay nothing.
+/// @tparam ObserverT Default-constructible type, constructed when a
+/// `co_await` starts. `OnSuspend()`, if defined, is called right before the
+/// coroutine suspends, and `OnResume()` once the awaited result is at hand;
+/// the latter may throw to fail the `co_await`. Senders are not observed.
+///
+template <typename ObserverT>
+struct ObservedAwaits
+{
+    /// @brief Concept contract: Wrap an operand of `co_await`.
+    /// @param awaitable Operand.
+    /// @returns Observed awaiter.
+    ///
+    template <typename U>
+    static auto AwaitTransform(U &&awaitable)
+    {
+        using AwaiterT = decltype(GetAwaiter(std::forward<U>(awaitable)));
+
+        return ObservedAwaiter<AwaiterT, ObserverT>{
+            std::forward<U>(awaitable)};
+    }
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_AWAIT_OBSERVER_H
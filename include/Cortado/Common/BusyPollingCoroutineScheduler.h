@@ -0,0 +1,315 @@
+/// @file BusyPollingCoroutineScheduler.h
+/// Low-latency thread pool whose workers spin instead of parking.
+///
+
+#ifndef CORTADO_COMMON_BUSY_POLLING_COROUTINE_SCHEDULER_H
+#define CORTADO_COMMON_BUSY_POLLING_COROUTINE_SCHEDULER_H
+
+// Cortado
+//
+#include <Cortado/CurrentScheduler.h>
+#include <Cortado/Detail/CpuRelax.h>
+
+// STL
+//
+#include <atomic>
+#include <cassert>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+
+// Linux
+//
+#include <pthread.h>
+#include <sched.h>
+
+#endif // __linux__
+
+namespace Cortado::Common
+{
+
+/// @brief Thread pool for the lowest-latency paths. Workers never park: they
+/// poll their mailboxes with a spin-wait hint, so a handoff costs a couple of
+/// cache line transfers instead of a futex or condition variable wake-up.
+/// Every worker owns one cache-line-padded single-slot mailbox per producer
+/// lane. Producer threads are assigned process-wide lanes on first use; as
+/// long as no more threads than lanes ever schedule coroutines, every mailbox
+/// has a single producer and a single consumer. The price is one core per
+/// worker at 100% load.
+///
+class BusyPollingCoroutineScheduler
+{
+public:
+    /// @brief Default number of producer lanes.
+    ///
+    static constexpr std::size_t DefaultProducerLanes = 64;
+
+    /// @brief Constructs a thread pool with unpinned workers.
+    /// @param numThreads Number of spinning workers.
+    /// @param producerLanes Number of mailboxes per worker.
+    ///
+    explicit BusyPollingCoroutineScheduler(
+        std::size_t numThreads = 1,
+        std::size_t producerLanes = DefaultProducerLanes) :
+        BusyPollingCoroutineScheduler(std::vector<int>(numThreads, -1),
+                                      producerLanes)
+    {
+    }
+
+    /// @brief Constructs a thread pool with one worker pinned to each of the
+    /// given CPUs. Pinning is only supported on Linux and is ignored
+    /// elsewhere; negative CPU index leaves the worker unpinned.
+    /// @param cpus CPU index for each worker.
+    /// @param producerLanes Number of mailboxes per worker.
+    ///
+    explicit BusyPollingCoroutineScheduler(
+        const std::vector<int> &cpus,
+        std::size_t producerLanes = DefaultProducerLanes) :
+        m_lanes{producerLanes > 0 ? producerLanes : 1},
+        m_workers(cpus.size())
+    {
+        for (Worker &w : m_workers)
+        {
+            w.Mailboxes = std::make_unique<Mailbox[]>(m_lanes);
+            w.Owner = this;
+        }
+
+        for (std::size_t i = 0; i < m_workers.size(); ++i)
+        {
+            m_workers[i].Thread = std::thread{
+                [this, i, cpu = cpus[i]]
+                {
+                    Pin(cpu);
+                    Run(m_workers[i]);
+                }};
+        }
+    }
+
+    /// @brief Stops and destroys threadpool. Workers keep running until every
+    /// scheduled coroutine has been resumed, including the ones scheduled by
+    /// workers while the pool drains. Scheduling from any other thread must
+    /// have stopped by the time destructor is called.
+    ///
+    ~BusyPollingCoroutineScheduler()
+    {
+        m_stop.store(true);
+
+        for (Worker &w : m_workers)
+        {
+            w.Thread.join();
+        }
+    }
+
+    /// @brief Concept contract: Hands coroutine to the next worker with a
+    /// free mailbox in the caller's lane. Spins if every worker is busy,
+    /// unless called from a worker, which then keeps the coroutine in its own
+    /// overflow queue.
+    /// @param h Coroutine to schedule.
+    ///
+    void Schedule(std::coroutine_handle<> h)
+    {
+        Worker *self = CurrentWorker();
+        const bool fromWorker = self != nullptr && self->Owner == this;
+
+        // Once stopping, only running coroutines may schedule, otherwise
+        // workers may have already left and nobody will drain the mailbox.
+        //
+        assert((fromWorker || !m_stop.load()) &&
+               "Coroutine scheduled on a stopped scheduler");
+
+        m_pending.fetch_add(1);
+
+        const std::size_t lane = GetProducerLane() % m_lanes;
+        std::size_t &next = NextWorker();
+
+        for (;;)
+        {
+            for (std::size_t i = 0; i < m_workers.size(); ++i)
+            {
+                Worker &w = m_workers[next++ % m_workers.size()];
+
+                // Lanes are process-wide, so a lane is only shared when more
+                // threads than lanes have ever scheduled coroutines; the CAS
+                // keeps the handoff correct when that happens.
+                //
+                void *expected = nullptr;
+                if (w.Mailboxes[lane].Handle.compare_exchange_strong(
+                        expected,
+                        h.address(),
+                        std::memory_order::release,
+                        std::memory_order::relaxed))
+                {
+                    return;
+                }
+            }
+
+            // A worker must not wait for mailboxes it may be the one to
+            // drain.
+            //
+            if (fromWorker)
+            {
+                self->Overflow.push_back(h);
+                return;
+            }
+
+            Detail::CpuRelax();
+        }
+    }
+
+    /// @brief Concept contract: Get app-global scheduler instance. It runs a
+    /// single unpinned worker; define a TaskImpl with a dedicated instance to
+    /// control the number of burned cores.
+    ///
+    static BusyPollingCoroutineScheduler &GetDefaultBackgroundScheduler()
+    {
+        static BusyPollingCoroutineScheduler sched;
+        return sched;
+    }
+
+private:
+    /// @brief Cache line size used for padding.
+    ///
+    static constexpr std::size_t CacheLineSize = 64;
+
+    /// @brief Single-slot mailbox on its own cache line.
+    ///
+    struct alignas(CacheLineSize) Mailbox
+    {
+        std::atomic<void *> Handle{nullptr};
+    };
+
+    /// @brief Worker's mailboxes and thread.
+    ///
+    struct Worker
+    {
+        std::unique_ptr<Mailbox[]> Mailboxes;
+
+        /// @brief Coroutines scheduled by the worker itself when all
+        /// mailboxes were full. Only accessed by the worker thread.
+        ///
+        std::deque<std::coroutine_handle<>> Overflow;
+
+        BusyPollingCoroutineScheduler *Owner = nullptr;
+        std::thread Thread;
+    };
+
+    /// @brief Process-wide lane of the calling thread, shared by all
+    /// instances.
+    ///
+    static std::size_t GetProducerLane() noexcept
+    {
+        static std::atomic_size_t nextLane{0};
+        static thread_local std::size_t lane =
+            nextLane.fetch_add(1, std::memory_order::relaxed);
+        return lane;
+    }
+
+    /// @brief Round-robin position of the calling thread.
+    ///
+    static std::size_t &NextWorker() noexcept
+    {
+        static thread_local std::size_t next = 0;
+        return next;
+    }
+
+    /// @brief Worker that runs on the calling thread, if any.
+    ///
+    static Worker *&CurrentWorker() noexcept
+    {
+        static thread_local Worker *current = nullptr;
+        return current;
+    }
+
+    /// @brief Pin calling thread to a CPU.
+    /// @param cpu CPU index, negative to leave thread unpinned.
+    ///
+    static void Pin([[maybe_unused]] int cpu) noexcept
+    {
+#ifdef __linux__
+        if (cpu < 0)
+        {
+            return;
+        }
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif // __linux__
+    }
+
+    /// @brief Worker thread entry point.
+    /// @param self Worker's own mailboxes.
+    ///
+    void Run(Worker &self)
+    {
+        CurrentSchedulerScope currentScheduler{*this};
+        CurrentWorker() = &self;
+
+        for (;;)
+        {
+            std::size_t resumed = 0;
+
+            // Only drain what was there before this pass, so that a
+            // coroutine rescheduling itself does not starve the mailboxes.
+            //
+            for (std::size_t n = self.Overflow.size(); n > 0; --n)
+            {
+                auto h = self.Overflow.front();
+                self.Overflow.pop_front();
+                h.resume();
+                ++resumed;
+            }
+
+            for (std::size_t i = 0; i < m_lanes; ++i)
+            {
+                std::atomic<void *> &slot = self.Mailboxes[i].Handle;
+                if (slot.load(std::memory_order::relaxed) == nullptr)
+                {
+                    continue;
+                }
+
+                void *address = slot.exchange(nullptr,
+                                              std::memory_order::acquire);
+                std::coroutine_handle<>::from_address(address).resume();
+                ++resumed;
+            }
+
+            if (resumed > 0)
+            {
+                m_pending.fetch_sub(resumed);
+                continue;
+            }
+
+            // A coroutine resumed by another worker may still schedule into
+            // this worker's mailboxes, so only leave once nothing is pending
+            // anywhere in the pool.
+            //
+            if (m_stop.load() && m_pending.load() == 0)
+            {
+                CurrentWorker() = nullptr;
+                return;
+            }
+
+            Detail::CpuRelax();
+        }
+    }
+
+    const std::size_t m_lanes;
+    std::vector<Worker> m_workers;
+    std::atomic_bool m_stop{false};
+
+    /// @brief Coroutines scheduled but not yet resumed to their next
+    /// suspension point.
+    ///
+    std::atomic_size_t m_pending{0};
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_BUSY_POLLING_COROUTINE_SCHEDULER_H
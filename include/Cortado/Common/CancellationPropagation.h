@@ -0,0 +1,59 @@
+/// @file CancellationPropagation.h
+/// Pre and post actions which carry a cancellation token along with the
+/// coroutine.
+///
+
+#ifndef CORTADO_COMMON_CANCELLATION_PROPAGATION_H
+#define CORTADO_COMMON_CANCELLATION_PROPAGATION_H
+
+// Cortado
+//
+#include <Cortado/Cancellation.h>
+#include <Cortado/Common/ThreadLocalPropagation.h>
+
+namespace Cortado::Common
+{
+
+/// @brief Cancellation token slot as seen by coroutines: they keep a copy
+/// of the token of their creator and only publish a pointer to it.
+///
+struct CoroutineCancellationTLS : CancellationTLS
+{
+    /// @brief Copy the token of currently running code.
+    ///
+    static CancellationToken Capture() noexcept
+    {
+        const CancellationToken *token = CancellationTLS::Get();
+        return token != nullptr ? *token : CancellationToken{};
+    }
+
+    /// @brief Publish coroutine's token on the current thread.
+    /// @param token Token owned by the coroutine.
+    /// @returns Token the thread had before.
+    ///
+    static const CancellationToken *Exchange(const CancellationToken &token)
+    {
+        return CancellationTLS::Exchange(&token);
+    }
+};
+
+/// @brief Pre and post actions which carry the cancellation token along with
+/// the coroutine. Mix into a TaskImpl to make its coroutines
+/// @link Cortado::Concepts::Cancellable Cancellable@endlink: children are
+/// cancelled together with their parent.
+///
+struct CancellationPreAndPostActions :
+    ThreadLocalPreAndPostActions<CoroutineCancellationTLS>
+{
+    /// @brief Concept contract: Token observed by built-in awaiters.
+    ///
+    static const CancellationToken &GetCancellationToken(
+        AdditionalStorage &s)
+    {
+        return s.Value;
+    }
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_CANCELLATION_PROPAGATION_H
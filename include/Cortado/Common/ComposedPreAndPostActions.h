@@ -0,0 +1,188 @@
+/// @file ComposedPreAndPostActions.h
+/// Combination of several pre and post actions in one TaskImpl.
+///
+
+#ifndef CORTADO_COMMON_COMPOSED_PRE_AND_POST_ACTIONS_H
+#define CORTADO_COMMON_COMPOSED_PRE_AND_POST_ACTIONS_H
+
+// Cortado
+//
+#include <Cortado/Concepts/Cancellable.h>
+#include <Cortado/Concepts/DeadlineAware.h>
+#include <Cortado/Concepts/PreAndPostAction.h>
+
+// STL
+//
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+namespace Cortado::Common
+{
+
+/// @brief Guards returned by `OnHandOver` of every composed action which
+/// has one, destroyed in reverse order.
+/// @tparam Actions Composed actions.
+///
+template <typename... Actions>
+class ComposedHandOff
+{
+};
+
+template <typename First, typename... Rest>
+class ComposedHandOff<First, Rest...>
+{
+public:
+    /// @brief Constructor. Hands over coroutine's state of every action.
+    /// @param first Storage of the first action.
+    /// @param rest Storages of the other actions.
+    ///
+    explicit ComposedHandOff(typename First::AdditionalStorage &first,
+                             typename Rest::AdditionalStorage &...rest) :
+        m_guard(HandOver(first)),
+        m_rest{rest...}
+    {
+    }
+
+    /// @brief Non-copyable.
+    ///
+    ComposedHandOff(const ComposedHandOff &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    ComposedHandOff &operator=(const ComposedHandOff &) = delete;
+
+private:
+    static auto HandOver(typename First::AdditionalStorage &s)
+    {
+        if constexpr (Concepts::HandOverAction<First>)
+        {
+            return First::OnHandOver(s);
+        }
+        else
+        {
+            return std::monostate{};
+        }
+    }
+
+    // Guards are neither copyable nor movable, and a prvalue is only
+    // constructed in place into a member which may not overlap others.
+    //
+    decltype(HandOver(std::declval<typename First::AdditionalStorage &>()))
+        m_guard;
+    [[no_unique_address]] ComposedHandOff<Rest...> m_rest;
+};
+
+/// @brief Pre and post actions made of several others, so that one TaskImpl
+/// can e.g. carry cancellation token, deadline and task context at once.
+/// Every action keeps its own storage; they are resumed in order and
+/// suspended or completed in reverse order. Optional hooks are forwarded to
+/// the actions which define them; accessors such as `GetCancellationToken`
+/// are forwarded to the first action which defines them.
+/// @tparam Actions Actions to combine.
+///
+template <Concepts::PreAndPostAction... Actions>
+struct ComposedPreAndPostActions
+{
+    using AdditionalStorage =
+        std::tuple<typename Actions::AdditionalStorage...>;
+
+    /// @brief Concept contract: Suspend every action, last one first.
+    ///
+    static void OnBeforeSuspend(AdditionalStorage &s)
+    {
+        Reversed(s,
+                 []<typename A>(typename A::AdditionalStorage &storage)
+                 { A::OnBeforeSuspend(storage); });
+    }
+
+    /// @brief Concept contract: Resume every action, first one first.
+    ///
+    static void OnBeforeResume(AdditionalStorage &s)
+    {
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        { (ActionAt<I>::OnBeforeResume(std::get<I>(s)), ...); }(
+            std::index_sequence_for<Actions...>{});
+    }
+
+    /// @brief Concept contract: Complete every action which has a
+    /// completion hook, last one first.
+    ///
+    static void OnCompletion(AdditionalStorage &s)
+        requires(Concepts::CompletionAction<Actions> || ...)
+    {
+        Reversed(s,
+                 []<typename A>(typename A::AdditionalStorage &storage)
+                 {
+                     if constexpr (Concepts::CompletionAction<A>)
+                     {
+                         A::OnCompletion(storage);
+                     }
+                 });
+    }
+
+    /// @brief Concept contract: Hand over coroutine's state of every action
+    /// which has a hand-over hook.
+    ///
+    static ComposedHandOff<Actions...> OnHandOver(AdditionalStorage &s)
+        requires(Concepts::HandOverAction<Actions> || ...)
+    {
+        return std::apply(
+            [](auto &...storages)
+            { return ComposedHandOff<Actions...>{storages...}; },
+            s);
+    }
+
+    /// @brief Concept contract: Token of the first cancellable action.
+    ///
+    static decltype(auto) GetCancellationToken(AdditionalStorage &s)
+        requires(Concepts::Cancellable<Actions> || ...)
+    {
+        constexpr std::size_t I = FirstOf({Concepts::Cancellable<Actions>...});
+        return ActionAt<I>::GetCancellationToken(std::get<I>(s));
+    }
+
+    /// @brief Concept contract: Attributes of the first deadline-aware
+    /// action.
+    ///
+    static decltype(auto) GetSchedulingAttributes(AdditionalStorage &s)
+        requires(Concepts::DeadlineAware<Actions> || ...)
+    {
+        constexpr std::size_t I =
+            FirstOf({Concepts::DeadlineAware<Actions>...});
+        return ActionAt<I>::GetSchedulingAttributes(std::get<I>(s));
+    }
+
+private:
+    template <std::size_t I>
+    using ActionAt = std::tuple_element_t<I, std::tuple<Actions...>>;
+
+    static constexpr std::size_t FirstOf(
+        std::array<bool, sizeof...(Actions)> matches)
+    {
+        std::size_t i = 0;
+        while (!matches[i])
+        {
+            ++i;
+        }
+        return i;
+    }
+
+    template <typename F>
+    static void Reversed(AdditionalStorage &s, F &&fn)
+    {
+        constexpr std::size_t N = sizeof...(Actions);
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            (fn.template operator()<ActionAt<N - 1 - I>>(
+                 std::get<N - 1 - I>(s)),
+             ...);
+        }(std::index_sequence_for<Actions...>{});
+    }
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_COMPOSED_PRE_AND_POST_ACTIONS_H
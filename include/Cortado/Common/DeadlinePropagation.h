@@ -0,0 +1,46 @@
+/// @file DeadlinePropagation.h
+/// Pre and post actions which carry deadline and priority along with the
+/// coroutine.
+///
+
+#ifndef CORTADO_COMMON_DEADLINE_PROPAGATION_H
+#define CORTADO_COMMON_DEADLINE_PROPAGATION_H
+
+// Cortado
+//
+#include <Cortado/Common/ThreadLocalPropagation.h>
+#include <Cortado/Deadline.h>
+
+namespace Cortado::Common
+{
+
+/// @brief Pre and post actions which carry deadline and priority along with
+/// the coroutine. Mix into a TaskImpl to make its coroutines
+/// @link Cortado::Concepts::DeadlineAware DeadlineAware@endlink: children
+/// inherit the attributes, schedulers such as @link
+/// Cortado::Common::PriorityCoroutineScheduler PriorityCoroutineScheduler
+/// @endlink queue by them, and scheduler hops past the deadline throw
+/// `OperationStopped`.
+///
+struct DeadlinePreAndPostActions : ThreadLocalPreAndPostActions<SchedulingTLS>
+{
+    /// @brief Concept contract: Hand coroutine's attributes to the scheduler
+    /// it is about to be queued in.
+    ///
+    static SchedulingHandOff OnHandOver(AdditionalStorage &s)
+    {
+        return SchedulingHandOff{s.Value};
+    }
+
+    /// @brief Concept contract: Attributes observed by built-in awaiters.
+    ///
+    static const SchedulingAttributes &GetSchedulingAttributes(
+        AdditionalStorage &s)
+    {
+        return s.Value;
+    }
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_DEADLINE_PROPAGATION_H
@@ -12,9 +12,16 @@
 //
 #include <dispatch/dispatch.h>
 
+// Cortado
+//
+#include <Cortado/CurrentScheduler.h>
+#include <Cortado/Detail/PostedWork.h>
+
 // STL
 //
 #include <coroutine>
+#include <type_traits>
+#include <utility>
 
 namespace Cortado::Common
 {
@@ -33,6 +40,21 @@ struct MacOSCoroutineScheduler
                          WorkCallback);
     }
 
+    /// @brief Concept contract: Runs a callable in a different thread. GCD
+    /// only carries a single context pointer, so the callable is moved into a
+    /// heap node.
+    /// @param fn Callable to run.
+    ///
+    template <typename F>
+    void Post(F &&fn)
+    {
+        using NodeT = Detail::PostedCallableNode<std::remove_cvref_t<F>>;
+
+        dispatch_async_f(dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0),
+                         NodeT::Create(std::forward<F>(fn)),
+                         PostCallback<NodeT>);
+    }
+
     /// @brief Concept contract: Get app-global scheduler instance.
     ///
     static MacOSCoroutineScheduler &GetDefaultBackgroundScheduler()
@@ -47,9 +69,26 @@ private:
     ///
     static void WorkCallback(void *context)
     {
+        // All instances share the global queue.
+        //
+        CurrentSchedulerScope currentScheduler{
+            GetDefaultBackgroundScheduler()};
+
         auto h = std::coroutine_handle<>::from_address(context);
         h();
     }
+
+    /// @brief GCD contract: Function that runs a posted callable.
+    /// @tparam NodeT Heap node type of the callable.
+    ///
+    template <typename NodeT>
+    static void PostCallback(void *context)
+    {
+        CurrentSchedulerScope currentScheduler{
+            GetDefaultBackgroundScheduler()};
+
+        NodeT::InvokeAndDestroy(context);
+    }
 };
 
 } // namespace Cortado::Common
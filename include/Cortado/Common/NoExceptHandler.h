@@ -0,0 +1,53 @@
+/// @file NoExceptHandler.h
+/// Error handler for coroutines that never fail.
+///
+
+#ifndef CORTADO_COMMON_NO_EXCEPT_HANDLER_H
+#define CORTADO_COMMON_NO_EXCEPT_HANDLER_H
+
+// STL
+//
+#include <exception>
+
+namespace Cortado::Common
+{
+
+/// @brief Concept contract: Error handler which stores nothing. An exception
+/// escaping a coroutine terminates the process, so the promise drops its
+/// error storage, error flag and rethrow branches. Works with exceptions
+/// disabled.
+///
+struct NoExceptHandler
+{
+    /// @brief Empty placeholder: there is no exception to store.
+    ///
+    struct NoException
+    {
+    };
+
+    /// @brief Concept contract: stored/rethrown exception type.
+    ///
+    using Exception = NoException;
+
+    /// @brief Marks the TaskImpl as @link Cortado::Concepts::NoExcept
+    /// NoExcept@endlink.
+    ///
+    static constexpr bool NoExcept = true;
+
+    /// @brief Concept contract: Exception catcher. Terminates.
+    ///
+    [[noreturn]] inline static NoException Catch()
+    {
+        std::terminate();
+    }
+
+    /// @brief Concept contract: Exception rethrower. Never called.
+    ///
+    inline static void Rethrow(NoException)
+    {
+    }
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_NO_EXCEPT_HANDLER_H
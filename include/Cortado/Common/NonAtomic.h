@@ -0,0 +1,134 @@
+/// @file NonAtomic.h
+/// Atomic primitive substitute for single-threaded code.
+///
+
+#ifndef CORTADO_COMMON_NON_ATOMIC_H
+#define CORTADO_COMMON_NON_ATOMIC_H
+
+// Cortado
+//
+#include <Cortado/Concepts/Atomic.h>
+
+// STL
+//
+#include <atomic>
+#include <utility>
+
+namespace Cortado::Common
+{
+
+/// @brief Plain integer with the interface of `std::atomic_int64_t`. Memory
+/// orders are ignored and every operation compiles to ordinary loads and
+/// stores, so it must only be used by coroutines that never cross threads.
+///
+class NonAtomic
+{
+public:
+    /// @brief Constructor.
+    /// @param value Initial value.
+    ///
+    constexpr NonAtomic(Concepts::AtomicPrimitive value = 0) noexcept :
+        m_value{value}
+    {
+    }
+
+    /// @brief Non-copyable, like `std::atomic`.
+    ///
+    NonAtomic(const NonAtomic &) = delete;
+
+    /// @brief Non-copyable, like `std::atomic`.
+    ///
+    NonAtomic &operator=(const NonAtomic &) = delete;
+
+    /// @brief Read value.
+    ///
+    Concepts::AtomicPrimitive load(
+        std::memory_order = std::memory_order::seq_cst) const noexcept
+    {
+        return m_value;
+    }
+
+    /// @brief Write value.
+    /// @param value New value.
+    ///
+    void store(Concepts::AtomicPrimitive value,
+               std::memory_order = std::memory_order::seq_cst) noexcept
+    {
+        m_value = value;
+    }
+
+    /// @brief Write value.
+    /// @param value New value.
+    /// @returns Previous value.
+    ///
+    Concepts::AtomicPrimitive exchange(
+        Concepts::AtomicPrimitive value,
+        std::memory_order = std::memory_order::seq_cst) noexcept
+    {
+        return std::exchange(m_value, value);
+    }
+
+    /// @brief Write value if it is equal to expected one.
+    /// @param expected Expected value, updated with the current one on
+    /// failure.
+    /// @param desired New value.
+    /// @returns true if value was written.
+    ///
+    bool compare_exchange_strong(
+        Concepts::AtomicPrimitive &expected,
+        Concepts::AtomicPrimitive desired,
+        std::memory_order = std::memory_order::seq_cst,
+        std::memory_order = std::memory_order::seq_cst) noexcept
+    {
+        if (m_value != expected)
+        {
+            expected = m_value;
+            return false;
+        }
+
+        m_value = desired;
+        return true;
+    }
+
+    /// @brief Same as `compare_exchange_strong`: plain compare never fails
+    /// spuriously.
+    ///
+    bool compare_exchange_weak(
+        Concepts::AtomicPrimitive &expected,
+        Concepts::AtomicPrimitive desired,
+        std::memory_order success = std::memory_order::seq_cst,
+        std::memory_order failure = std::memory_order::seq_cst) noexcept
+    {
+        return compare_exchange_strong(expected, desired, success, failure);
+    }
+
+    /// @brief Pre-increment.
+    /// @returns New value.
+    ///
+    Concepts::AtomicPrimitive operator++() noexcept
+    {
+        return ++m_value;
+    }
+
+    /// @brief Pre-decrement.
+    /// @returns New value.
+    ///
+    Concepts::AtomicPrimitive operator--() noexcept
+    {
+        return --m_value;
+    }
+
+private:
+    Concepts::AtomicPrimitive m_value;
+};
+
+/// @brief Struct which defines non-atomic primitive implementation.
+///
+struct NonAtomicPrimitive
+{
+    using Atomic = NonAtomic;
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_NON_ATOMIC_H
@@ -0,0 +1,21 @@
+/// @file OriginalSchedulerAffinity.h
+/// Scheduler affinity policy for TaskImpl.
+///
+
+#ifndef CORTADO_COMMON_ORIGINAL_SCHEDULER_AFFINITY_H
+#define CORTADO_COMMON_ORIGINAL_SCHEDULER_AFFINITY_H
+
+namespace Cortado::Common
+{
+
+/// @brief Concept contract: Mix into a TaskImpl to resume awaiting
+/// coroutines on their original scheduler after a child task completes.
+///
+struct OriginalSchedulerAffinity
+{
+    static constexpr bool ResumeOnOriginalScheduler = true;
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_ORIGINAL_SCHEDULER_AFFINITY_H
@@ -7,20 +7,87 @@
 
 #ifdef _POSIX_VERSION
 
+// Cortado
+//
+#include <Cortado/CurrentScheduler.h>
+#include <Cortado/Detail/PostedWork.h>
+#include <Cortado/Detail/Throw.h>
+
 // POSIX
 //
+#include <errno.h>
+#include <limits.h>
 #include <pthread.h>
+#include <time.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif // __GLIBC__
 
 // STL
 //
+#include <algorithm>
+#include <chrono>
 #include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
 #include <queue>
+#include <system_error>
 #include <thread>
 #include <vector>
 
 namespace Cortado::Common
 {
 
+/// @brief Construction options of @link
+/// Cortado::Common::PosixCoroutineScheduler PosixCoroutineScheduler@endlink.
+///
+struct PosixCoroutineSchedulerOptions
+{
+    /// @brief Number of threads in pool.
+    ///
+    std::size_t NumThreads = std::thread::hardware_concurrency();
+
+    /// @brief Stack size of each worker. Coroutine frames live on the heap,
+    /// so workers only need room for the synchronous code they resume.
+    /// Rounded up to `PTHREAD_STACK_MIN`. System default if empty.
+    ///
+    std::optional<std::size_t> StackSize{};
+
+    /// @brief Size of the guard area below each worker stack. System default
+    /// if empty.
+    ///
+    std::optional<std::size_t> GuardSize{};
+
+    /// @brief How long the whole pool must stay without work, i.e. with an
+    /// empty queue and no worker running a job, before `OnIdle` is called.
+    /// Zero disables the idle hook.
+    ///
+    std::chrono::milliseconds IdleDelay{0};
+
+    /// @brief Called by one worker, outside of the queue lock, once per quiet
+    /// period. Returns memory cached by the allocator to the OS by default;
+    /// see `TrimHeap` for what that affects.
+    ///
+    std::function<void()> OnIdle = TrimHeap;
+
+    /// @brief Default idle hook. Calls `malloc_trim` on glibc, which releases
+    /// free pages of every arena with `madvise(MADV_DONTNEED)`. Does nothing
+    /// on other C libraries. The trim is process-wide: it walks arenas used
+    /// by every thread, not only by this pool, and each pool with an idle
+    /// delay calls it after its own quiet period. Set `OnIdle` to an empty
+    /// function on all but one pool to trim once per process.
+    ///
+    static void TrimHeap()
+    {
+#ifdef __GLIBC__
+        malloc_trim(0);
+#endif // __GLIBC__
+    }
+};
+
 class PosixCoroutineScheduler
 {
 public:
@@ -29,16 +96,65 @@ public:
     /// @param numThreads Number of threads in pool.
     ///
     PosixCoroutineScheduler(
-        size_t numThreads = std::thread::hardware_concurrency()) : stop{false}
+        size_t numThreads = std::thread::hardware_concurrency()) :
+        PosixCoroutineScheduler(
+            PosixCoroutineSchedulerOptions{.NumThreads = numThreads})
+    {
+    }
+
+    /// @brief Constructs a thread pool with the given options.
+    /// @param options Pool options.
+    /// @throws std::system_error If a worker thread could not be configured
+    /// or started. Workers started so far are joined before throwing.
+    ///
+    explicit PosixCoroutineScheduler(PosixCoroutineSchedulerOptions options) :
+        m_idleDelay{options.IdleDelay},
+        m_onIdle{std::move(options.OnIdle)},
+        stop{false}
     {
         pthread_mutex_init(&m_queueMutex, nullptr);
-        pthread_cond_init(&m_condition, nullptr);
+        InitCondition();
+
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+
+        int err = 0;
+
+        if (options.StackSize)
+        {
+            err = pthread_attr_setstacksize(
+                &attr,
+                std::max<std::size_t>(*options.StackSize, PTHREAD_STACK_MIN));
+        }
 
-        for (size_t i = 0; i < numThreads; ++i)
+        if (err == 0 && options.GuardSize)
+        {
+            err = pthread_attr_setguardsize(&attr, *options.GuardSize);
+        }
+
+        for (size_t i = 0; err == 0 && i < options.NumThreads; ++i)
         {
             pthread_t thread;
-            pthread_create(&thread, nullptr, WorkerFn, this);
-            m_threads.push_back(thread);
+            err = pthread_create(&thread, &attr, WorkerFn, this);
+            if (err == 0)
+            {
+                m_threads.push_back(thread);
+            }
+        }
+
+        pthread_attr_destroy(&attr);
+
+        if (err != 0)
+        {
+            // Destructor does not run for a partially constructed pool.
+            //
+            Shutdown();
+            pthread_mutex_destroy(&m_queueMutex);
+            pthread_cond_destroy(&m_condition);
+            Detail::Throw(std::system_error{
+                err,
+                std::generic_category(),
+                "Failed to start PosixCoroutineScheduler worker"});
         }
     }
 
@@ -56,10 +172,18 @@ public:
     ///
     void Schedule(std::coroutine_handle<> h)
     {
-        pthread_mutex_lock(&m_queueMutex);
-        m_tasks.push(std::move(h));
-        pthread_cond_signal(&m_condition);
-        pthread_mutex_unlock(&m_queueMutex);
+        Enqueue(Detail::PostedWork{h});
+    }
+
+    /// @brief Concept contract: Runs a callable in a different thread.
+    /// Callables of up to `PostedWork::InlineSize` bytes are stored in the
+    /// queue itself without a heap allocation.
+    /// @param fn Callable to run.
+    ///
+    template <typename F>
+    void Post(F &&fn)
+    {
+        Enqueue(Detail::PostedWork{std::forward<F>(fn)});
     }
 
     /// @brief Concept contract: Get app-global scheduler instance.
@@ -71,6 +195,19 @@ public:
     }
 
 private:
+    /// @brief Put a job to the queue and wake up a worker.
+    /// @param work Job to run.
+    ///
+    void Enqueue(Detail::PostedWork &&work)
+    {
+        pthread_mutex_lock(&m_queueMutex);
+        m_tasks.push(std::move(work));
+        m_trimmed = false;
+        ++m_workEpoch;
+        pthread_cond_signal(&m_condition);
+        pthread_mutex_unlock(&m_queueMutex);
+    }
+
     /// @brief Worker thread callback for pthread
     /// @param arg Type-erased scheduler object
     ///
@@ -86,14 +223,47 @@ private:
     ///
     void Run()
     {
+        CurrentSchedulerScope currentScheduler{*this};
+
+        bool ranTask = false;
+
         while (true)
         {
-            std::coroutine_handle<> task;
+            Detail::PostedWork task;
 
             pthread_mutex_lock(&m_queueMutex);
+
+            if (ranTask)
+            {
+                --m_busyWorkers;
+            }
+
             while (m_tasks.empty() && !stop)
             {
-                pthread_cond_wait(&m_condition, &m_queueMutex);
+                // Only a quiet pool counts down to the idle hook. The worker
+                // which finishes the last job starts the countdown.
+                //
+                if (m_trimmed || m_busyWorkers != 0 ||
+                    m_idleDelay.count() == 0 || !m_onIdle)
+                {
+                    pthread_cond_wait(&m_condition, &m_queueMutex);
+                    continue;
+                }
+
+                const auto epoch = m_workEpoch;
+                timespec deadline = IdleDeadline();
+                if (pthread_cond_timedwait(
+                        &m_condition, &m_queueMutex, &deadline) == ETIMEDOUT &&
+                    m_workEpoch == epoch && !stop && !m_trimmed)
+                {
+                    // Claim the quiet period so that other idle workers go
+                    // back to sleep instead of trimming again.
+                    //
+                    m_trimmed = true;
+                    pthread_mutex_unlock(&m_queueMutex);
+                    m_onIdle();
+                    pthread_mutex_lock(&m_queueMutex);
+                }
             }
 
             if (stop && m_tasks.empty())
@@ -104,12 +274,53 @@ private:
 
             task = std::move(m_tasks.front());
             m_tasks.pop();
+            ++m_busyWorkers;
+            ranTask = true;
             pthread_mutex_unlock(&m_queueMutex);
 
             task();
         }
     }
 
+    /// @brief Initialize condition variable on the monotonic clock where
+    /// supported, so that idle timeouts are not affected by clock changes.
+    ///
+    void InitCondition()
+    {
+#ifdef __linux__
+        pthread_condattr_t attr;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&m_condition, &attr);
+        pthread_condattr_destroy(&attr);
+#else
+        pthread_cond_init(&m_condition, nullptr);
+#endif // __linux__
+    }
+
+    /// @brief Absolute deadline of the idle wait on the condition clock.
+    ///
+    timespec IdleDeadline() const
+    {
+        timespec now;
+#ifdef __linux__
+        clock_gettime(CLOCK_MONOTONIC, &now);
+#else
+        clock_gettime(CLOCK_REALTIME, &now);
+#endif // __linux__
+
+        const auto delay =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(m_idleDelay);
+        const auto ns = now.tv_nsec + delay.count() % 1'000'000'000;
+
+        timespec deadline;
+        deadline.tv_sec = now.tv_sec +
+                          static_cast<time_t>(delay.count() / 1'000'000'000) +
+                          static_cast<time_t>(ns / 1'000'000'000);
+        deadline.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+        return deadline;
+    }
+
     /// @brief Shuts down threads
     ///
     void Shutdown()
@@ -128,9 +339,24 @@ private:
     }
 
     std::vector<pthread_t> m_threads;
-    std::queue<std::coroutine_handle<>> m_tasks;
+    std::queue<Detail::PostedWork> m_tasks;
     pthread_mutex_t m_queueMutex;
     pthread_cond_t m_condition;
+    std::chrono::milliseconds m_idleDelay;
+    std::function<void()> m_onIdle;
+
+    /// @brief Number of workers running a job.
+    ///
+    std::size_t m_busyWorkers = 0;
+
+    /// @brief Number of jobs ever queued, so that an idle countdown notices
+    /// work that came and went while it waited.
+    ///
+    std::uint64_t m_workEpoch = 0;
+
+    /// @brief Idle hook already ran since the last job was queued.
+    ///
+    bool m_trimmed = false;
     bool stop;
 };
 
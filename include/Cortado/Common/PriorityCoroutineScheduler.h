@@ -0,0 +1,194 @@
+/// @file PriorityCoroutineScheduler.h
+/// Thread pool which resumes coroutines by priority and deadline.
+///
+
+#ifndef CORTADO_COMMON_PRIORITY_COROUTINE_SCHEDULER_H
+#define CORTADO_COMMON_PRIORITY_COROUTINE_SCHEDULER_H
+
+// Cortado
+//
+#include <Cortado/CurrentScheduler.h>
+#include <Cortado/Deadline.h>
+#include <Cortado/Detail/PostedWork.h>
+
+// STL
+//
+#include <algorithm>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Cortado::Common
+{
+
+/// @brief Thread pool with a priority queue. Work is queued with the
+/// @link Cortado::SchedulingAttributes SchedulingAttributes@endlink of the
+/// coroutine being scheduled, or of the posting code: higher priority runs
+/// first, then earlier deadline, then first come first served. Coroutines
+/// past their deadline are still resumed, so that they unwind with
+/// `OperationStopped` instead of hanging.
+///
+class PriorityCoroutineScheduler
+{
+public:
+    /// @brief Constructs a thread pool with numThreads threads.
+    /// @param numThreads Number of threads in pool.
+    ///
+    PriorityCoroutineScheduler(
+        size_t numThreads = std::thread::hardware_concurrency())
+    {
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            m_threads.emplace_back([this] { Run(); });
+        }
+    }
+
+    /// @brief Stops and destroys threadpool.
+    ///
+    ~PriorityCoroutineScheduler()
+    {
+        {
+            std::lock_guard lk{m_queueMutex};
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (std::thread &t : m_threads)
+        {
+            t.join();
+        }
+    }
+
+    /// @brief Concept contract: Schedules coroutine with the attributes of
+    /// the coroutine being suspended.
+    /// @param h Coroutine to schedule.
+    ///
+    void Schedule(std::coroutine_handle<> h)
+    {
+        Schedule(h, SchedulingTLS::ForScheduling());
+    }
+
+    /// @brief Schedules coroutine with the given attributes.
+    /// @param h Coroutine to schedule.
+    /// @param attributes Deadline and priority.
+    ///
+    void Schedule(std::coroutine_handle<> h,
+                  const SchedulingAttributes &attributes)
+    {
+        Enqueue(Detail::PostedWork{h}, attributes);
+    }
+
+    /// @brief Concept contract: Runs a callable with the attributes of the
+    /// posting code.
+    /// @param fn Callable to run.
+    ///
+    template <typename F>
+    void Post(F &&fn)
+    {
+        Post(std::forward<F>(fn), SchedulingTLS::ForScheduling());
+    }
+
+    /// @brief Runs a callable with the given attributes.
+    /// @param fn Callable to run.
+    /// @param attributes Deadline and priority.
+    ///
+    template <typename F>
+    void Post(F &&fn, const SchedulingAttributes &attributes)
+    {
+        Enqueue(Detail::PostedWork{std::forward<F>(fn)}, attributes);
+    }
+
+    /// @brief Concept contract: Get app-global scheduler instance.
+    ///
+    static PriorityCoroutineScheduler &GetDefaultBackgroundScheduler()
+    {
+        static PriorityCoroutineScheduler sched;
+        return sched;
+    }
+
+private:
+    /// @brief Queued job with its ordering key.
+    ///
+    struct Entry
+    {
+        SchedulingAttributes Attributes;
+        std::uint64_t Sequence;
+        Detail::PostedWork Work;
+    };
+
+    /// @brief Heap order: the entry which must run first is the greatest.
+    ///
+    static bool RunsLater(const Entry &lhs, const Entry &rhs) noexcept
+    {
+        if (lhs.Attributes.Priority != rhs.Attributes.Priority)
+        {
+            return lhs.Attributes.Priority < rhs.Attributes.Priority;
+        }
+
+        if (lhs.Attributes.Deadline != rhs.Attributes.Deadline)
+        {
+            return lhs.Attributes.Deadline > rhs.Attributes.Deadline;
+        }
+
+        return lhs.Sequence > rhs.Sequence;
+    }
+
+    /// @brief Put a job to the queue and wake up a worker.
+    /// @param work Job to run.
+    /// @param attributes Deadline and priority.
+    ///
+    void Enqueue(Detail::PostedWork &&work,
+                 const SchedulingAttributes &attributes)
+    {
+        {
+            std::lock_guard lk{m_queueMutex};
+            m_tasks.push_back(
+                Entry{attributes, m_nextSequence++, std::move(work)});
+            std::push_heap(m_tasks.begin(), m_tasks.end(), RunsLater);
+        }
+        m_condition.notify_one();
+    }
+
+    /// @brief Worker thread entry point.
+    ///
+    void Run()
+    {
+        CurrentSchedulerScope currentScheduler{*this};
+
+        for (;;)
+        {
+            Detail::PostedWork task;
+            {
+                std::unique_lock lk{m_queueMutex};
+                m_condition.wait(lk,
+                                 [this] { return m_stop || !m_tasks.empty(); });
+
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+
+                std::pop_heap(m_tasks.begin(), m_tasks.end(), RunsLater);
+                task = std::move(m_tasks.back().Work);
+                m_tasks.pop_back();
+            }
+
+            task();
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::vector<Entry> m_tasks;
+    std::uint64_t m_nextSequence = 0;
+    std::mutex m_queueMutex;
+    std::condition_variable m_condition;
+    bool m_stop = false;
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_PRIORITY_COROUTINE_SCHEDULER_H
@@ -13,23 +13,23 @@ namespace Cortado::Common
 {
 
 /// @brief Allocator implementation which is basically STL allocator of bytes.
+/// It is stateless, so it is not stored in coroutine frames.
 ///
 struct STLAllocator
 {
-    std::allocator<std::byte> m_allocator;
-
     /// @brief Concept contract: Allocates requested amount of bytes.
     ///
     void *allocate(std::size_t size)
     {
-        return m_allocator.allocate(size);
+        return std::allocator<std::byte>{}.allocate(size);
     }
 
     /// @brief Concept contract: Deallocates requested pointer.
     ///
     void deallocate(void *ptr, std::size_t size)
     {
-        m_allocator.deallocate(reinterpret_cast<std::byte *>(ptr), size);
+        std::allocator<std::byte>{}.deallocate(
+            reinterpret_cast<std::byte *>(ptr), size);
     }
 };
 
@@ -0,0 +1,63 @@
+/// @file SingleThreadedEvent.h
+/// Completion event for coroutines that never cross threads.
+///
+
+#ifndef CORTADO_COMMON_SINGLE_THREADED_EVENT_H
+#define CORTADO_COMMON_SINGLE_THREADED_EVENT_H
+
+// STL
+//
+#include <exception>
+
+namespace Cortado::Common
+{
+
+/// @brief Event backed by a plain flag. Setting it costs a store and never
+/// enters the kernel. There is no other thread that could set it while the
+/// caller blocks, so waiting for an unset event is a deadlock: `Wait`
+/// terminates, and `WaitFor` returns immediately.
+///
+class SingleThreadedEvent
+{
+public:
+    /// @brief Concept contract: Set event.
+    ///
+    void Set() noexcept
+    {
+        m_set = true;
+    }
+
+    /// @brief Concept contract: Check if event is set.
+    ///
+    bool IsSet() const noexcept
+    {
+        return m_set;
+    }
+
+    /// @brief Concept contract: Sync wait. Must only be called once the event
+    /// is set, e.g. after the coroutine completed synchronously or its
+    /// driving loop ran dry.
+    ///
+    void Wait() const noexcept
+    {
+        if (!m_set)
+        {
+            std::terminate();
+        }
+    }
+
+    /// @brief Concept contract: Sync wait with timeout.
+    /// @returns true if event is set.
+    ///
+    bool WaitFor(unsigned long) const noexcept
+    {
+        return m_set;
+    }
+
+private:
+    bool m_set = false;
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_SINGLE_THREADED_EVENT_H
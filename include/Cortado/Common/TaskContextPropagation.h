@@ -0,0 +1,54 @@
+/// @file TaskContextPropagation.h
+/// Pre and post actions which carry the task context along with the
+/// coroutine.
+///
+
+#ifndef CORTADO_COMMON_TASK_CONTEXT_PROPAGATION_H
+#define CORTADO_COMMON_TASK_CONTEXT_PROPAGATION_H
+
+// Cortado
+//
+#include <Cortado/Common/ThreadLocalPropagation.h>
+#include <Cortado/TaskContext.h>
+
+namespace Cortado::Common
+{
+
+/// @brief Task context slot as seen by coroutines: they keep a reference to
+/// the context of their creator and only publish its node.
+///
+struct CoroutineTaskContextTLS : TaskContextTLS
+{
+    /// @brief Take a reference to the context of currently running code.
+    ///
+    static TaskContext Capture() noexcept
+    {
+        return TaskContext::Current();
+    }
+
+    /// @brief Publish coroutine's context on the current thread.
+    /// @param context Context owned by the coroutine.
+    /// @returns Context the thread had before.
+    ///
+    static const Detail::TaskContextNode *Exchange(const TaskContext &context)
+    {
+        return TaskContextTLS::Exchange(context.Node());
+    }
+};
+
+/// @brief Pre and post actions which carry the task context along with the
+/// coroutine. Mix into a TaskImpl so that coroutines see the values of
+/// their creator in @link Cortado::ContextSlot ContextSlot@endlink.
+/// The context is referenced once, at creation; every resumption and
+/// suspension then swaps one thread-local pointer. Use @link
+/// Cortado::Common::ComposedPreAndPostActions ComposedPreAndPostActions
+/// @endlink to carry it together with other per-coroutine state.
+///
+struct TaskContextPreAndPostActions :
+    ThreadLocalPreAndPostActions<CoroutineTaskContextTLS>
+{
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_TASK_CONTEXT_PROPAGATION_H
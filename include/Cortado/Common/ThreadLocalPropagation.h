@@ -0,0 +1,93 @@
+/// @file ThreadLocalPropagation.h
+/// Pre and post actions which carry a thread-local value along with the
+/// coroutine.
+///
+
+#ifndef CORTADO_COMMON_THREAD_LOCAL_PROPAGATION_H
+#define CORTADO_COMMON_THREAD_LOCAL_PROPAGATION_H
+
+// STL
+//
+#include <type_traits>
+#include <utility>
+
+namespace Cortado::Common
+{
+
+/// @brief Per-coroutine storage of a value propagated by @link
+/// Cortado::Common::ThreadLocalPreAndPostActions
+/// ThreadLocalPreAndPostActions@endlink.
+/// @tparam TLS Thread-local slot of the value.
+///
+template <typename TLS>
+struct ThreadLocalStorage
+{
+private:
+    static auto Capture()
+    {
+        if constexpr (requires { TLS::Capture(); })
+        {
+            return TLS::Capture();
+        }
+        else
+        {
+            return std::remove_cvref_t<decltype(TLS::Get())>{TLS::Get()};
+        }
+    }
+
+public:
+    /// @brief Value of the code that created the coroutine. `TLS::Capture()`
+    /// if the slot only publishes a reference to it, `TLS::Get()` otherwise.
+    ///
+    decltype(Capture()) Value = Capture();
+
+    /// @brief Value of the code that resumed the coroutine, given back to
+    /// the thread when the coroutine suspends or completes. Right after
+    /// creation it is the creator's value.
+    ///
+    std::remove_cvref_t<decltype(TLS::Get())> Previous = TLS::Get();
+};
+
+/// @brief Pre and post actions which carry a thread-local value along with
+/// the coroutine. The value of the creating code is captured once; every
+/// resumption publishes it on the resuming thread with a single exchange,
+/// and every suspension or completion gives the thread back what it had.
+/// Keep published values small: a pointer into the storage is best.
+/// Combine with other actions through @link
+/// Cortado::Common::ComposedPreAndPostActions ComposedPreAndPostActions
+/// @endlink.
+/// @tparam TLS Thread-local slot with static `Get()`, `Set(previous)` and
+/// `Exchange(value)`, and optionally `Capture()` for values which are owned
+/// by the coroutine and published by reference.
+///
+template <typename TLS>
+struct ThreadLocalPreAndPostActions
+{
+    using AdditionalStorage = ThreadLocalStorage<TLS>;
+
+    /// @brief Concept contract: Give the thread back its own value.
+    ///
+    static void OnBeforeSuspend(AdditionalStorage &s)
+    {
+        TLS::Set(std::move(s.Previous));
+    }
+
+    /// @brief Concept contract: Publish coroutine's value on the thread it
+    /// is resumed on, so that children inherit it.
+    ///
+    static void OnBeforeResume(AdditionalStorage &s)
+    {
+        s.Previous = TLS::Exchange(s.Value);
+    }
+
+    /// @brief Concept contract: Give the thread back its own value.
+    ///
+    static void OnCompletion(AdditionalStorage &s)
+    {
+        TLS::Set(std::move(s.Previous));
+    }
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_THREAD_LOCAL_PROPAGATION_H
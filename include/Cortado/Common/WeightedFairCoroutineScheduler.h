@@ -0,0 +1,354 @@
+/// @file WeightedFairCoroutineScheduler.h
+/// Thread pool which shares workers between tenants using deficit round-robin.
+///
+
+#ifndef CORTADO_COMMON_WEIGHTED_FAIR_COROUTINE_SCHEDULER_H
+#define CORTADO_COMMON_WEIGHTED_FAIR_COROUTINE_SCHEDULER_H
+
+// Cortado
+//
+#include <Cortado/Common/ThreadLocalPropagation.h>
+#include <Cortado/CurrentScheduler.h>
+#include <Cortado/Detail/PostedWork.h>
+
+// STL
+//
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Cortado::Common
+{
+
+/// @brief Tenant identifier. Tenant 0 is the default tenant for coroutines
+/// created outside of any @link Cortado::Common::TenantScope
+/// TenantScope@endlink.
+///
+using TenantId = std::uint32_t;
+
+/// @brief Thread-local storage of the tenant that owns currently running code.
+///
+struct TenantTLS
+{
+    /// @brief Get tenant of the current thread.
+    /// @returns Tenant id.
+    ///
+    inline static TenantId Get()
+    {
+        return GetImpl();
+    }
+
+    /// @brief Set tenant of the current thread.
+    /// @param tenant Tenant id.
+    ///
+    inline static void Set(TenantId tenant)
+    {
+        GetImpl() = tenant;
+    }
+
+    /// @brief Set tenant of the current thread.
+    /// @param tenant Tenant id.
+    /// @returns Tenant the thread had before.
+    ///
+    inline static TenantId Exchange(TenantId tenant)
+    {
+        return std::exchange(GetImpl(), tenant);
+    }
+
+private:
+    static TenantId &GetImpl()
+    {
+        static thread_local TenantId current = 0;
+        return current;
+    }
+};
+
+/// @brief RAII helper which makes all coroutines created in its scope belong
+/// to the given tenant.
+///
+class TenantScope
+{
+public:
+    /// @brief Constructor. Switches current thread to the tenant.
+    /// @param tenant Tenant id.
+    ///
+    explicit TenantScope(TenantId tenant) : m_previous{TenantTLS::Get()}
+    {
+        TenantTLS::Set(tenant);
+    }
+
+    /// @brief Non-copyable.
+    ///
+    TenantScope(const TenantScope &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    TenantScope &operator=(const TenantScope &) = delete;
+
+    /// @brief Destructor. Restores previous tenant.
+    ///
+    ~TenantScope()
+    {
+        TenantTLS::Set(m_previous);
+    }
+
+private:
+    TenantId m_previous;
+};
+
+/// @brief Pre and post actions which carry the tenant id along with the
+/// coroutine. Mix into a TaskImpl to make scheduling tenant-aware.
+///
+struct TenantPreAndPostActions : ThreadLocalPreAndPostActions<TenantTLS>
+{
+    /// @brief Concept contract: Queue the coroutine on behalf of its tenant
+    /// when an awaiter hands it to a scheduler.
+    ///
+    static TenantScope OnHandOver(AdditionalStorage &s)
+    {
+        return TenantScope{s.Value};
+    }
+};
+
+/// @brief Thread pool with a sub-queue per tenant. Workers pick sub-queues
+/// with deficit round-robin, so every tenant with pending work gets a share
+/// of workers proportional to its weight regardless of how many coroutines
+/// other tenants submit. The deficit counts resumed coroutines and jobs, not
+/// CPU time: a tenant whose coroutines run longer between suspensions gets
+/// more worker time than its weight suggests.
+///
+class WeightedFairCoroutineScheduler
+{
+public:
+    /// @brief Constructs a thread pool with numThreads threads.
+    /// @param numThreads Number of threads in pool.
+    ///
+    WeightedFairCoroutineScheduler(
+        size_t numThreads = std::thread::hardware_concurrency())
+    {
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            m_threads.emplace_back([this] { Run(); });
+        }
+    }
+
+    /// @brief Stops and destroys threadpool.
+    ///
+    ~WeightedFairCoroutineScheduler()
+    {
+        {
+            std::lock_guard lk{m_queueMutex};
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (std::thread &t : m_threads)
+        {
+            t.join();
+        }
+    }
+
+    /// @brief Set relative share of a tenant. A tenant with weight 3 resumes
+    /// three coroutines per round while a tenant with weight 1 resumes one.
+    /// The weight is kept after the tenant runs out of work.
+    /// @param tenant Tenant id.
+    /// @param weight Number of coroutines resumed per round, at least 1.
+    ///
+    void SetWeight(TenantId tenant, std::uint32_t weight)
+    {
+        std::lock_guard lk{m_queueMutex};
+
+        TenantQueue &queue = m_tenants[tenant];
+        queue.Tenant = tenant;
+        queue.Weight = weight > 0 ? weight : 1;
+        queue.Weighted = true;
+    }
+
+    /// @brief Number of tenants the scheduler keeps state for: those with
+    /// queued work and those with a weight set. Others are forgotten once
+    /// their sub-queue drains.
+    ///
+    std::size_t TenantCount()
+    {
+        std::lock_guard lk{m_queueMutex};
+        return m_tenants.size();
+    }
+
+    /// @brief Concept contract: Schedules coroutine on behalf of the tenant
+    /// of the current thread.
+    /// @param h Coroutine to schedule.
+    ///
+    void Schedule(std::coroutine_handle<> h)
+    {
+        Schedule(h, TenantTLS::Get());
+    }
+
+    /// @brief Schedules coroutine on behalf of the given tenant.
+    /// @param h Coroutine to schedule.
+    /// @param tenant Tenant id.
+    ///
+    void Schedule(std::coroutine_handle<> h, TenantId tenant)
+    {
+        Enqueue(Detail::PostedWork{h}, tenant);
+    }
+
+    /// @brief Concept contract: Runs a callable on behalf of the tenant of
+    /// the current thread.
+    /// @param fn Callable to run.
+    ///
+    template <typename F>
+    void Post(F &&fn)
+    {
+        Post(std::forward<F>(fn), TenantTLS::Get());
+    }
+
+    /// @brief Runs a callable on behalf of the given tenant.
+    /// @param fn Callable to run.
+    /// @param tenant Tenant id.
+    ///
+    template <typename F>
+    void Post(F &&fn, TenantId tenant)
+    {
+        Enqueue(Detail::PostedWork{std::forward<F>(fn)}, tenant);
+    }
+
+    /// @brief Concept contract: Get app-global scheduler instance.
+    ///
+    static WeightedFairCoroutineScheduler &GetDefaultBackgroundScheduler()
+    {
+        static WeightedFairCoroutineScheduler sched;
+        return sched;
+    }
+
+private:
+    /// @brief Per-tenant sub-queue.
+    ///
+    struct TenantQueue
+    {
+        TenantId Tenant = 0;
+        std::deque<Detail::PostedWork> Tasks;
+        std::uint32_t Weight = 1;
+        std::int64_t Deficit = 0;
+        bool Active = false;
+
+        /// @brief Weight was set explicitly, so the entry outlives the
+        /// tenant's work.
+        ///
+        bool Weighted = false;
+    };
+
+    /// @brief Put a job to the tenant's sub-queue and wake up a worker.
+    /// @param work Job to run.
+    /// @param tenant Tenant id.
+    ///
+    void Enqueue(Detail::PostedWork &&work, TenantId tenant)
+    {
+        {
+            std::lock_guard lk{m_queueMutex};
+
+            TenantQueue &queue = m_tenants[tenant];
+            queue.Tenant = tenant;
+            queue.Tasks.push_back(std::move(work));
+
+            if (!queue.Active)
+            {
+                queue.Active = true;
+                m_activeTenants.push_back(&queue);
+            }
+        }
+        m_condition.notify_one();
+    }
+
+    /// @brief Worker thread entry point. Jobs run on behalf of the tenant
+    /// they were queued for, so that work they post is charged to it.
+    ///
+    void Run()
+    {
+        CurrentSchedulerScope currentScheduler{*this};
+
+        for (;;)
+        {
+            Detail::PostedWork task;
+            TenantId tenant = 0;
+            {
+                std::unique_lock lk{m_queueMutex};
+                m_condition.wait(lk,
+                                 [this]
+                                 { return m_stop || !m_activeTenants.empty(); });
+
+                if (m_activeTenants.empty())
+                {
+                    return;
+                }
+
+                tenant = m_activeTenants.front()->Tenant;
+                task = PopNextLocked();
+            }
+
+            TenantScope tenantScope{tenant};
+            task();
+        }
+    }
+
+    /// @brief Deficit round-robin step. Must be called under the queue lock
+    /// with at least one active tenant.
+    /// @returns Next job to run.
+    ///
+    Detail::PostedWork PopNextLocked()
+    {
+        TenantQueue *queue = m_activeTenants.front();
+
+        // Tenant's turn has just started - grant it a quantum.
+        //
+        if (queue->Deficit <= 0)
+        {
+            queue->Deficit += queue->Weight;
+        }
+
+        Detail::PostedWork task = std::move(queue->Tasks.front());
+        queue->Tasks.pop_front();
+        --queue->Deficit;
+
+        if (queue->Tasks.empty())
+        {
+            // Idle tenants do not accumulate credit.
+            //
+            queue->Deficit = 0;
+            queue->Active = false;
+            m_activeTenants.pop_front();
+
+            // Tenant ids may be per request or per connection; do not keep
+            // an entry for every id ever seen.
+            //
+            if (!queue->Weighted)
+            {
+                m_tenants.erase(queue->Tenant);
+            }
+        }
+        else if (queue->Deficit <= 0)
+        {
+            m_activeTenants.pop_front();
+            m_activeTenants.push_back(queue);
+        }
+
+        return task;
+    }
+
+    std::vector<std::thread> m_threads;
+    std::unordered_map<TenantId, TenantQueue> m_tenants;
+    std::deque<TenantQueue *> m_activeTenants;
+    std::mutex m_queueMutex;
+    std::condition_variable m_condition;
+    bool m_stop = false;
+};
+
+} // namespace Cortado::Common
+
+#endif // CORTADO_COMMON_WEIGHTED_FAIR_COROUTINE_SCHEDULER_H
@@ -11,9 +11,16 @@
 //
 #include <threadpoolapiset.h>
 
+// Cortado
+//
+#include <Cortado/CurrentScheduler.h>
+#include <Cortado/Detail/PostedWork.h>
+
 // STL
 //
 #include <coroutine>
+#include <type_traits>
+#include <utility>
 
 namespace Cortado::Common
 {
@@ -39,6 +46,22 @@ struct Win32CoroutineScheduler
         CloseThreadpoolWork(work);
     }
 
+    /// @brief Concept contract: Runs a callable in a different thread. The
+    /// threadpool callback only carries a single pointer, so the callable is
+    /// moved into a heap node.
+    /// @param fn Callable to run.
+    ///
+    template <typename F>
+    void Post(F &&fn)
+    {
+        using NodeT = Detail::PostedCallableNode<std::remove_cvref_t<F>>;
+
+        PTP_WORK work = CreateThreadpoolWork(
+            PostCallback<NodeT>, NodeT::Create(std::forward<F>(fn)), nullptr);
+        SubmitThreadpoolWork(work);
+        CloseThreadpoolWork(work);
+    }
+
     /// @brief Concept contract: Get app-global scheduler instance.
     ///
     static Win32CoroutineScheduler &GetDefaultBackgroundScheduler()
@@ -55,9 +78,28 @@ private:
                                       PVOID Context,
                                       PTP_WORK)
     {
+        // All instances share the process-wide pool.
+        //
+        CurrentSchedulerScope currentScheduler{
+            GetDefaultBackgroundScheduler()};
+
         auto h = std::coroutine_handle<>::from_address(Context);
         h();
     }
+
+    /// @brief Win32 contract: Function that runs a posted callable.
+    /// @tparam NodeT Heap node type of the callable.
+    ///
+    template <typename NodeT>
+    static void CALLBACK PostCallback(PTP_CALLBACK_INSTANCE,
+                                      PVOID Context,
+                                      PTP_WORK)
+    {
+        CurrentSchedulerScope currentScheduler{
+            GetDefaultBackgroundScheduler()};
+
+        NodeT::InvokeAndDestroy(Context);
+    }
 };
 
 } // namespace Cortado::Common
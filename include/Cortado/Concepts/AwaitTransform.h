@@ -0,0 +1,27 @@
+/// @file AwaitTransform.h
+/// Definition of the AwaitTransform concept.
+///
+
+#ifndef CORTADO_CONCEPTS_AWAIT_TRANSFORM_H
+#define CORTADO_CONCEPTS_AWAIT_TRANSFORM_H
+
+// STL
+//
+#include <coroutine>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Concept for TaskImpl types that rewrite every `co_await` operand in
+/// their coroutines, e.g. to wrap it into an awaiter that checks
+/// cancellation, charges a budget or measures latency. `T::AwaitTransform`
+/// is a static function template taking the operand by forwarding reference
+/// and returning what is actually awaited.
+/// @tparam T Candidate TaskImpl type.
+///
+template <typename T>
+concept AwaitTransform = requires { T::AwaitTransform(std::suspend_never{}); };
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_AWAIT_TRANSFORM_H
@@ -0,0 +1,36 @@
+/// @file Cancellable.h
+/// Definition of the Cancellable concept.
+///
+
+#ifndef CORTADO_CONCEPTS_CANCELLABLE_H
+#define CORTADO_CONCEPTS_CANCELLABLE_H
+
+// Cortado
+//
+#include <Cortado/Concepts/PreAndPostAction.h>
+
+// STL
+//
+#include <concepts>
+#include <stop_token>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Concept for TaskImpl types whose coroutines carry a cancellation
+/// token in their additional storage. Built-in awaiters of such coroutines
+/// resume early with `OperationStopped` once the token is cancelled.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink type.
+///
+template <typename T>
+concept Cancellable =
+    HasAdditionalStorage<T> &&
+    requires(typename T::AdditionalStorage &additionalStorage) {
+        {
+            T::GetCancellationToken(additionalStorage)
+        } -> std::same_as<const std::stop_token &>;
+    };
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_CANCELLABLE_H
@@ -9,6 +9,7 @@
 //
 #include <concepts>
 #include <cstddef>
+#include <type_traits>
 
 namespace Cortado::Concepts
 {
@@ -25,6 +26,37 @@ concept CoroutineAllocator = requires(T t, void *p, std::size_t s) {
     { t.deallocate(p, s) } -> std::same_as<void>;
 };
 
+/// @brief Allocator which needs no state to free memory: it is empty, or
+/// declares `is_always_equal` like standard allocators do, and can be
+/// default-constructed. Such allocators are not stored in coroutine frames.
+/// @tparam T @link Cortado::Concepts::CoroutineAllocator
+/// CoroutineAllocator@endlink type.
+///
+template <typename T>
+concept StatelessAllocator =
+    std::is_default_constructible_v<T> &&
+    (std::is_empty_v<T> || requires {
+        requires std::bool_constant<T::is_always_equal::value>::value;
+    });
+
+/// @brief Allocator, typically a ref-counted handle to a pool, which can
+/// free memory through a trivially copyable handle, e.g. a raw pointer to
+/// the pool. Frames then store the handle instead of a copy of the
+/// allocator, and creating a frame touches no reference counter. The pool
+/// must stay alive until its last frame is freed, e.g. by counting
+/// outstanding blocks in `allocate`/`deallocate`.
+/// @tparam T @link Cortado::Concepts::CoroutineAllocator
+/// CoroutineAllocator@endlink type.
+///
+template <typename T>
+concept FrameHandleAllocator =
+    CoroutineAllocator<T> &&
+    std::is_trivially_copyable_v<typename T::FrameHandle> &&
+    requires(const T &t, typename T::FrameHandle h, void *p, std::size_t s) {
+        { t.GetFrameHandle() } -> std::same_as<typename T::FrameHandle>;
+        { T::Deallocate(h, p, s) } -> std::same_as<void>;
+    };
+
 /// @brief Helper concept to define if T defines
 /// @link Cortado::Concepts::CoroutineAllocator CoroutineAllocator@endlink type.
 /// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink type.
@@ -8,6 +8,7 @@
 // STL
 //
 #include <coroutine>
+#include <type_traits>
 
 namespace Cortado::Concepts
 {
@@ -22,6 +23,17 @@ concept CoroutineScheduler =
         { t.Schedule(h) };
     };
 
+/// @brief PostingScheduler is a CoroutineScheduler that can also run plain
+/// callables without wrapping them into a coroutine frame.
+/// @tparam T Scheduler type.
+///
+template <typename T>
+concept PostingScheduler =
+    CoroutineScheduler<T> &&
+    requires(std::remove_reference_t<T> t, void (*fn)()) {
+        { t.Post(fn) };
+    };
+
 } // namespace Cortado::Concepts
 
 #endif
\ No newline at end of file
@@ -0,0 +1,36 @@
+/// @file DeadlineAware.h
+/// Definition of the DeadlineAware concept.
+///
+
+#ifndef CORTADO_CONCEPTS_DEADLINE_AWARE_H
+#define CORTADO_CONCEPTS_DEADLINE_AWARE_H
+
+// Cortado
+//
+#include <Cortado/Concepts/PreAndPostAction.h>
+#include <Cortado/Deadline.h>
+
+// STL
+//
+#include <concepts>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Concept for TaskImpl types whose coroutines carry a deadline and
+/// a priority in their additional storage. Built-in scheduler hops of such
+/// coroutines resume with `OperationStopped` once the deadline has passed.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink type.
+///
+template <typename T>
+concept DeadlineAware =
+    HasAdditionalStorage<T> &&
+    requires(typename T::AdditionalStorage &additionalStorage) {
+        {
+            T::GetSchedulingAttributes(additionalStorage)
+        } -> std::same_as<const SchedulingAttributes &>;
+    };
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_DEADLINE_AWARE_H
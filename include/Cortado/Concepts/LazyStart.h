@@ -0,0 +1,26 @@
+/// @file LazyStart.h
+/// Definition of the LazyStart concept.
+///
+
+#ifndef CORTADO_CONCEPTS_LAZY_START_H
+#define CORTADO_CONCEPTS_LAZY_START_H
+
+// STL
+//
+#include <concepts>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Concept for TaskImpl types whose coroutines do not run until they
+/// are awaited or waited for.
+/// @tparam T Candidate TaskImpl type.
+///
+template <typename T>
+concept LazyStart = requires {
+    { T::StartOnAwait } -> std::convertible_to<bool>;
+} && T::StartOnAwait;
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_LAZY_START_H
@@ -0,0 +1,27 @@
+/// @file NoExcept.h
+/// Definition of the NoExcept concept.
+///
+
+#ifndef CORTADO_CONCEPTS_NO_EXCEPT_H
+#define CORTADO_CONCEPTS_NO_EXCEPT_H
+
+// STL
+//
+#include <concepts>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Concept for TaskImpl types whose coroutines never complete with an
+/// error. Promise keeps no error storage and terminates if an exception
+/// escapes coroutine body.
+/// @tparam T Candidate TaskImpl type.
+///
+template <typename T>
+concept NoExcept = requires {
+    { T::NoExcept } -> std::convertible_to<bool>;
+} && T::NoExcept;
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_NO_EXCEPT_H
@@ -36,6 +36,32 @@ concept PreAndPostAction =
         { T::OnBeforeResume(additionalStorage) } -> std::same_as<void>;
     };
 
+/// @brief Optional addition to PreAndPostAction: called once when coroutine
+/// body finishes, on the thread it finished on, so that actions can undo
+/// what `OnBeforeResume` did to that thread.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink type.
+///
+template <typename T>
+concept CompletionAction =
+    HasAdditionalStorage<T> &&
+    requires(typename T::AdditionalStorage &additionalStorage) {
+        { T::OnCompletion(additionalStorage) } -> std::same_as<void>;
+    };
+
+/// @brief Optional addition to PreAndPostAction: called right before a
+/// built-in awaiter hands the coroutine over to a scheduler. Returns a guard
+/// which lives until the scheduler has taken the coroutine, so that the
+/// scheduler can see coroutine's state after `OnBeforeSuspend` gave the
+/// thread back its own.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink type.
+///
+template <typename T>
+concept HandOverAction =
+    HasAdditionalStorage<T> &&
+    requires(typename T::AdditionalStorage &additionalStorage) {
+        T::OnHandOver(additionalStorage);
+    };
+
 } // namespace Cortado::Concepts
 
 #endif
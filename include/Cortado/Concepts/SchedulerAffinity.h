@@ -0,0 +1,27 @@
+/// @file SchedulerAffinity.h
+/// Definition of the SchedulerAffinity concept.
+///
+
+#ifndef CORTADO_CONCEPTS_SCHEDULER_AFFINITY_H
+#define CORTADO_CONCEPTS_SCHEDULER_AFFINITY_H
+
+// STL
+//
+#include <concepts>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Concept for TaskImpl types that want a coroutine to continue on
+/// the scheduler it was running on before it awaited a child task, even if
+/// the child completes on a different scheduler.
+/// @tparam T Candidate TaskImpl type.
+///
+template <typename T>
+concept SchedulerAffinity = requires {
+    { T::ResumeOnOriginalScheduler } -> std::convertible_to<bool>;
+} && T::ResumeOnOriginalScheduler;
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_SCHEDULER_AFFINITY_H
@@ -0,0 +1,98 @@
+/// @file Sender.h
+/// Definition of the Sender and Receiver concepts.
+///
+
+#ifndef CORTADO_CONCEPTS_SENDER_H
+#define CORTADO_CONCEPTS_SENDER_H
+
+// STL
+//
+#include <concepts>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Receiver is a completion sink of an asynchronous operation. This
+/// is the single-value subset of the P2300 member protocol: exactly one of
+/// `set_value`, `set_error` or `set_stopped` is called exactly once.
+/// @tparam R Candidate receiver type.
+/// @tparam V Value type, `void` for operations without a result.
+///
+template <typename R, typename V>
+concept Receiver =
+    std::move_constructible<std::remove_cvref_t<R>> &&
+    requires(std::remove_cvref_t<R> r, std::exception_ptr e) {
+        { std::move(r).set_error(std::move(e)) };
+        { std::move(r).set_stopped() };
+    } &&
+    ((std::is_void_v<V> && requires(std::remove_cvref_t<R> r) {
+         { std::move(r).set_value() };
+     }) ||
+     (!std::is_void_v<V> && requires(std::remove_cvref_t<R> r, V &&v) {
+         { std::move(r).set_value(std::forward<V>(v)) };
+     }));
+
+/// @brief Operation state is what connecting a sender to a receiver produces.
+/// Nothing happens until `start` is called; the object must stay alive and
+/// in place until the receiver is completed.
+/// @tparam O Candidate operation state type.
+///
+template <typename O>
+concept OperationState = requires(O &op) {
+    { op.start() } noexcept;
+};
+
+} // namespace Cortado::Concepts
+
+namespace Cortado::Detail
+{
+
+/// @brief Receiver archetype used to check the Sender concept.
+/// @tparam V Value type.
+///
+template <typename V>
+struct ReceiverArchetype
+{
+    void set_value(V &&) noexcept;
+    void set_error(std::exception_ptr) noexcept;
+    void set_stopped() noexcept;
+};
+
+/// @brief Receiver archetype used to check the Sender concept.
+///
+template <>
+struct ReceiverArchetype<void>
+{
+    void set_value() noexcept;
+    void set_error(std::exception_ptr) noexcept;
+    void set_stopped() noexcept;
+};
+
+} // namespace Cortado::Detail
+
+namespace Cortado::Concepts
+{
+
+/// @brief Sender describes an asynchronous operation that completes with a
+/// single value of `value_type`, an error or a stop signal. Connecting it to
+/// a receiver gives an operation state which the caller keeps in place, so
+/// composition does not need heap allocations.
+/// @tparam S Candidate sender type.
+///
+template <typename S>
+concept Sender =
+    requires { typename std::remove_cvref_t<S>::value_type; } &&
+    requires(std::remove_cvref_t<S> s) {
+        {
+            std::move(s).connect(
+                Detail::ReceiverArchetype<
+                    typename std::remove_cvref_t<S>::value_type>{})
+        } -> OperationState;
+    };
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_SENDER_H
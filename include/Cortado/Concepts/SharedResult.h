@@ -0,0 +1,26 @@
+/// @file SharedResult.h
+/// Definition of the SharedResult concept.
+///
+
+#ifndef CORTADO_CONCEPTS_SHARED_RESULT_H
+#define CORTADO_CONCEPTS_SHARED_RESULT_H
+
+// STL
+//
+#include <concepts>
+
+namespace Cortado::Concepts
+{
+
+/// @brief Concept for TaskImpl types whose coroutines may be awaited by many
+/// coroutines at once, each of which observes the same result.
+/// @tparam T Candidate TaskImpl type.
+///
+template <typename T>
+concept SharedResult = requires {
+    { T::ShareResult } -> std::convertible_to<bool>;
+} && T::ShareResult;
+
+} // namespace Cortado::Concepts
+
+#endif // CORTADO_CONCEPTS_SHARED_RESULT_H
@@ -18,13 +18,15 @@ namespace Cortado::Concepts
 /// A task implementation is something that:<br>
 /// 1) Defines how to handle exceptions;<br>
 /// 2) Defines an atomic integer (std::atomic_ulong or substitute);<br>
-/// 3) Defines waitable event;<br>
+/// 3) Optionally defines waitable event. Without it tasks can only be
+/// `co_await`ed, and completing them never touches a kernel object;<br>
 /// 4) Defines allocator to be used for allocations.
 /// @tparam T Candidate for TaskImpl.
 ///
 template <typename T>
-concept TaskImpl =
-    ErrorHandler<T> && HasAtomic<T> && HasEvent<T> && HasCoroutineAllocator<T>;
+concept TaskImpl = ErrorHandler<T> && HasAtomic<T> &&
+                   (HasEvent<T> || !requires { typename T::Event; }) &&
+                   HasCoroutineAllocator<T>;
 
 } // namespace Cortado::Concepts
 
@@ -0,0 +1,110 @@
+/// @file CurrentScheduler.h
+/// Thread-local reference to the scheduler that owns the current thread.
+///
+
+#ifndef CORTADO_CURRENT_SCHEDULER_H
+#define CORTADO_CURRENT_SCHEDULER_H
+
+// Cortado
+//
+#include <Cortado/SchedulerRef.h>
+
+// STL
+//
+#include <coroutine>
+
+namespace Cortado
+{
+
+/// @brief Access to the scheduler that runs the current thread. Built-in
+/// schedulers publish themselves on their worker threads; on any other
+/// thread the reference is empty.
+///
+struct CurrentScheduler
+{
+    /// @brief Get scheduler of the current thread.
+    /// @returns Scheduler reference, empty if thread is not a worker.
+    ///
+    inline static SchedulerRef Get() noexcept
+    {
+        return GetImpl();
+    }
+
+    /// @brief Set scheduler of the current thread.
+    /// @param sched Scheduler reference.
+    ///
+    inline static void Set(SchedulerRef sched) noexcept
+    {
+        GetImpl() = sched;
+    }
+
+private:
+    static SchedulerRef &GetImpl() noexcept
+    {
+        static thread_local SchedulerRef current;
+        return current;
+    }
+};
+
+/// @brief RAII helper for scheduler implementations: marks the current
+/// thread as owned by a scheduler while in scope.
+///
+class CurrentSchedulerScope
+{
+public:
+    /// @brief Constructor. Publishes the scheduler for the current thread.
+    /// @param sched Scheduler which owns the thread.
+    ///
+    explicit CurrentSchedulerScope(SchedulerRef sched) noexcept :
+        m_previous{CurrentScheduler::Get()}
+    {
+        CurrentScheduler::Set(sched);
+    }
+
+    /// @brief Non-copyable.
+    ///
+    CurrentSchedulerScope(const CurrentSchedulerScope &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    CurrentSchedulerScope &operator=(const CurrentSchedulerScope &) = delete;
+
+    /// @brief Destructor. Restores previous scheduler.
+    ///
+    ~CurrentSchedulerScope()
+    {
+        CurrentScheduler::Set(m_previous);
+    }
+
+private:
+    SchedulerRef m_previous;
+};
+
+namespace Detail
+{
+/// @brief Continuation resumer which keeps a coroutine on the scheduler it
+/// was suspended on: resumes in place if already there, reschedules
+/// otherwise.
+/// @param h Coroutine to resume.
+/// @param context Pointer to the original `SchedulerRef`.
+/// @returns The coroutine if the caller must resume it, e.g. by symmetric
+/// transfer, `noop_coroutine` if it was rescheduled.
+///
+inline std::coroutine_handle<> ResumeOnScheduler(std::coroutine_handle<> h,
+                                                 void *context)
+{
+    const SchedulerRef &original = *static_cast<SchedulerRef *>(context);
+
+    if (CurrentScheduler::Get() == original)
+    {
+        return h;
+    }
+
+    original.Schedule(h);
+    return std::noop_coroutine();
+}
+} // namespace Detail
+
+} // namespace Cortado
+
+#endif // CORTADO_CURRENT_SCHEDULER_H
@@ -0,0 +1,234 @@
+/// @file Deadline.h
+/// Deadline and priority of coroutine trees.
+///
+
+#ifndef CORTADO_DEADLINE_H
+#define CORTADO_DEADLINE_H
+
+// Cortado
+//
+#include <Cortado/Detail/Throw.h>
+#include <Cortado/OperationStopped.h>
+
+// STL
+//
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <utility>
+
+namespace Cortado
+{
+
+/// @brief Clock of deadlines.
+///
+using DeadlineClock = std::chrono::steady_clock;
+
+/// @brief Deadline and priority of a request. Coroutines inherit them from
+/// the code that creates them; schedulers queue by them and built-in
+/// awaiters refuse to hop once the deadline has passed.
+///
+struct SchedulingAttributes
+{
+    /// @brief Point in time after which results are of no use. No deadline
+    /// by default.
+    ///
+    DeadlineClock::time_point Deadline = DeadlineClock::time_point::max();
+
+    /// @brief Higher values are resumed first.
+    ///
+    int Priority = 0;
+
+    /// @brief Check if deadline has passed.
+    ///
+    bool IsExpired() const noexcept
+    {
+        return Deadline != DeadlineClock::time_point::max() &&
+               DeadlineClock::now() >= Deadline;
+    }
+};
+
+/// @brief Thread-local storage of the scheduling attributes of currently
+/// running code.
+///
+struct SchedulingTLS
+{
+    /// @brief Get attributes of the current thread.
+    /// @returns Attributes, default if nothing set them.
+    ///
+    inline static const SchedulingAttributes &Get()
+    {
+        return GetImpl().Current;
+    }
+
+    /// @brief Set attributes of the current thread.
+    /// @param attributes Attributes.
+    ///
+    inline static void Set(const SchedulingAttributes &attributes)
+    {
+        GetImpl().Current = attributes;
+    }
+
+    /// @brief Set attributes of the current thread.
+    /// @param attributes Attributes.
+    /// @returns Attributes the thread had before.
+    ///
+    inline static SchedulingAttributes Exchange(
+        const SchedulingAttributes &attributes)
+    {
+        return std::exchange(GetImpl().Current, attributes);
+    }
+
+    /// @brief Remember attributes of a coroutine which is being handed over
+    /// to a scheduler, so that the scheduler sees them even though the
+    /// thread already went back to its own attributes.
+    /// @param attributes Attributes of the suspending coroutine.
+    ///
+    inline static void SetSuspending(const SchedulingAttributes &attributes)
+    {
+        GetImpl().Suspending = attributes;
+    }
+
+    /// @brief Forget attributes of a coroutine handed over to a scheduler.
+    ///
+    inline static void ClearSuspending()
+    {
+        GetImpl().Suspending.reset();
+    }
+
+    /// @brief Attributes a scheduler must queue newly scheduled work with:
+    /// those of the coroutine being handed over, if any, otherwise those of
+    /// currently running code.
+    /// @returns Attributes.
+    ///
+    inline static SchedulingAttributes ForScheduling()
+    {
+        auto &tls = GetImpl();
+        if (tls.Suspending)
+        {
+            return *std::exchange(tls.Suspending, std::nullopt);
+        }
+
+        return tls.Current;
+    }
+
+private:
+    struct State
+    {
+        SchedulingAttributes Current;
+        std::optional<SchedulingAttributes> Suspending;
+    };
+
+    static State &GetImpl()
+    {
+        static thread_local State state;
+        return state;
+    }
+};
+
+/// @brief RAII helper for awaiters which hand a coroutine over to a
+/// scheduler: the scheduler queues it with the attributes of the coroutine
+/// rather than those of the thread. The attributes are forgotten on exit,
+/// so that work posted later from the thread does not inherit them.
+///
+class SchedulingHandOff
+{
+public:
+    /// @brief Constructor. Publishes attributes of the coroutine.
+    /// @param attributes Attributes of the coroutine being handed over.
+    ///
+    explicit SchedulingHandOff(const SchedulingAttributes &attributes)
+    {
+        SchedulingTLS::SetSuspending(attributes);
+    }
+
+    /// @brief Non-copyable.
+    ///
+    SchedulingHandOff(const SchedulingHandOff &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    SchedulingHandOff &operator=(const SchedulingHandOff &) = delete;
+
+    /// @brief Destructor. Forgets attributes of the coroutine.
+    ///
+    ~SchedulingHandOff()
+    {
+        SchedulingTLS::ClearSuspending();
+    }
+};
+
+/// @brief RAII helper which gives all coroutines created in its scope a
+/// deadline and a priority. A deadline never extends the deadline of
+/// enclosing code.
+///
+class SchedulingScope
+{
+public:
+    /// @brief Constructor. Switches current thread to the attributes.
+    /// @param attributes Attributes.
+    ///
+    explicit SchedulingScope(SchedulingAttributes attributes) :
+        m_previous{SchedulingTLS::Get()}
+    {
+        attributes.Deadline =
+            std::min(attributes.Deadline, m_previous.Deadline);
+        SchedulingTLS::Set(attributes);
+    }
+
+    /// @brief Constructor. Keeps priority and sets a deadline relative to
+    /// now.
+    /// @param timeout Time left.
+    ///
+    template <typename Rep, typename Period>
+    explicit SchedulingScope(std::chrono::duration<Rep, Period> timeout) :
+        SchedulingScope{SchedulingAttributes{
+            .Deadline = DeadlineClock::now() +
+                        std::chrono::duration_cast<DeadlineClock::duration>(
+                            timeout),
+            .Priority = SchedulingTLS::Get().Priority}}
+    {
+    }
+
+    /// @brief Non-copyable.
+    ///
+    SchedulingScope(const SchedulingScope &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    SchedulingScope &operator=(const SchedulingScope &) = delete;
+
+    /// @brief Destructor. Restores previous attributes.
+    ///
+    ~SchedulingScope()
+    {
+        SchedulingTLS::Set(m_previous);
+    }
+
+private:
+    SchedulingAttributes m_previous;
+};
+
+/// @brief Check if the deadline of currently running code has passed.
+/// Meant for long stretches of synchronous work.
+/// @returns true if deadline has passed.
+///
+inline bool IsDeadlineExceeded()
+{
+    return SchedulingTLS::Get().IsExpired();
+}
+
+/// @brief Throw `OperationStopped` if the deadline of currently running
+/// code has passed.
+///
+inline void ThrowIfDeadlineExceeded()
+{
+    if (IsDeadlineExceeded())
+    {
+        Detail::Throw(OperationStopped{});
+    }
+}
+
+} // namespace Cortado
+
+#endif // CORTADO_DEADLINE_H
@@ -28,6 +28,18 @@ struct DefaultTaskImpl :
     using Event = Cortado::DefaultEvent;
 };
 
+/// @brief Default implementation without completion event. Such tasks can
+/// only be `co_await`ed or polled with `IsReady`, but completing them costs
+/// a single atomic operation and no syscalls.
+///
+struct ContinuationOnlyTaskImpl :
+    Common::STLAtomic,
+    Common::STLCoroutineAllocator,
+    Common::STLExceptionHandler,
+    DefaultScheduler
+{
+};
+
 } // namespace Cortado
 
 #endif
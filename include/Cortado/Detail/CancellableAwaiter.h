@@ -0,0 +1,240 @@
+/// @file CancellableAwaiter.h
+/// Cancellation support shared by built-in awaiters.
+///
+
+#ifndef CORTADO_DETAIL_CANCELLABLE_AWAITER_H
+#define CORTADO_DETAIL_CANCELLABLE_AWAITER_H
+
+// Cortado
+//
+#include <Cortado/Concepts/Cancellable.h>
+#include <Cortado/Concepts/DeadlineAware.h>
+#include <Cortado/Detail/CoroutineAwaiterQueueNode.h>
+#include <Cortado/Detail/Throw.h>
+#include <Cortado/OperationStopped.h>
+
+// STL
+//
+#include <atomic>
+#include <coroutine>
+#include <optional>
+#include <stop_token>
+#include <utility>
+
+namespace Cortado::Detail
+{
+
+/// @brief Cancellation check for awaiters which cannot take the coroutine
+/// back once it is handed over, such as scheduler hops: a cancelled
+/// coroutine, or one past its deadline, does not hop, and a coroutine
+/// cancelled or expired while in flight throws right after it is resumed.
+///
+class CancellationCheck
+{
+public:
+    /// @brief Remember the token and the deadline of the awaiting coroutine.
+    /// @param h Awaiting coroutine.
+    /// @returns false if the coroutine is already cancelled or expired and
+    /// must not suspend.
+    ///
+    template <Concepts::TaskImpl T, typename R>
+    bool Capture(std::coroutine_handle<PromiseType<T, R>> h) noexcept
+    {
+        if constexpr (Concepts::Cancellable<T>)
+        {
+            m_token = &h.promise().GetCancellationToken();
+        }
+
+        if constexpr (Concepts::DeadlineAware<T>)
+        {
+            m_attributes = &h.promise().GetSchedulingAttributes();
+        }
+
+        return !IsStopped();
+    }
+
+    /// @brief Throw `OperationStopped` if the coroutine was cancelled or its
+    /// deadline has passed.
+    ///
+    void ThrowIfCancelled() const
+    {
+        if (IsStopped())
+        {
+            Detail::Throw(OperationStopped{});
+        }
+    }
+
+private:
+    bool IsStopped() const noexcept
+    {
+        return (m_token != nullptr && m_token->stop_requested()) ||
+               (m_attributes != nullptr && m_attributes->IsExpired());
+    }
+
+    const std::stop_token *m_token{nullptr};
+    const SchedulingAttributes *m_attributes{nullptr};
+};
+
+/// @brief Find and unlink a node from a singly-linked list of awaiters.
+/// @param head List head, updated if the node was the head.
+/// @param node Node to unlink.
+/// @returns true if the node was found.
+///
+inline bool UnlinkWaiter(CoroutineAwaiterQueueNode *&head,
+                         CoroutineAwaiterQueueNode *node) noexcept
+{
+    for (CoroutineAwaiterQueueNode **link = &head; *link != nullptr;
+         link = &(*link)->Next)
+    {
+        if (*link == node)
+        {
+            *link = node->Next;
+            node->Next = nullptr;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief Get the last node of a non-empty list of awaiters.
+///
+inline CoroutineAwaiterQueueNode *GetLastWaiter(
+    CoroutineAwaiterQueueNode *head) noexcept
+{
+    while (head->Next != nullptr)
+    {
+        head = head->Next;
+    }
+
+    return head;
+}
+
+/// @brief Queue node of an awaiter which leaves the wait list of its
+/// primitive when the awaiting coroutine is cancelled, and resumes it
+/// right away. `AwaiterT` provides `RemoveFromWaitList()`, which returns
+/// true if it unlinked the node before the primitive picked it.
+/// @tparam AwaiterT Derived awaiter type.
+///
+template <typename AwaiterT>
+class CancellableQueueNode : public CoroutineAwaiterQueueNode
+{
+public:
+    /// @brief Default constructor.
+    ///
+    CancellableQueueNode() = default;
+
+    /// @brief Move constructor. Awaiters are only moved before they are
+    /// awaited, so there is no cancellation state to move.
+    ///
+    CancellableQueueNode(CancellableQueueNode &&other) noexcept :
+        CoroutineAwaiterQueueNode{std::move(other)}
+    {
+    }
+
+    /// @brief Primitive contract: The node was picked from the wait list, so
+    /// it can no longer be cancelled.
+    ///
+    void Grant() noexcept
+    {
+        m_cancelState.store(Granted, std::memory_order::release);
+    }
+
+    /// @brief Check if the node was picked from the wait list.
+    ///
+    bool IsGranted() const noexcept
+    {
+        return m_cancelState.load(std::memory_order::acquire) == Granted;
+    }
+
+protected:
+    /// @brief Subscribe to cancellation of the awaiting coroutine. Must be
+    /// called before the node is published in the wait list.
+    /// @param h Awaiting coroutine.
+    /// @returns false if the coroutine is already cancelled and must not
+    /// suspend.
+    ///
+    template <Concepts::TaskImpl T, typename R>
+    bool ArmCancellation(std::coroutine_handle<PromiseType<T, R>> h)
+    {
+        if constexpr (Concepts::Cancellable<T>)
+        {
+            const std::stop_token &token = h.promise().GetCancellationToken();
+            if (!token.stop_possible())
+            {
+                return true;
+            }
+
+            if (token.stop_requested())
+            {
+                m_cancelled = true;
+                return false;
+            }
+
+            m_callback.emplace(token, OnCancel{this});
+
+            // Cancellation which fired while subscribing did not touch the
+            // wait list.
+            //
+            auto expected = Arming;
+            if (!m_cancelState.compare_exchange_strong(
+                    expected, Armed, std::memory_order::acq_rel))
+            {
+                m_cancelled = true;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// @brief Unsubscribe from cancellation, waiting for a callback that
+    /// runs on another thread.
+    /// @returns true if the awaiter was cancelled.
+    ///
+    bool DisarmCancellation() noexcept
+    {
+        m_callback.reset();
+        return m_cancelled;
+    }
+
+private:
+    struct OnCancel
+    {
+        CancellableQueueNode *Self;
+
+        void operator()() const noexcept
+        {
+            Self->Cancel();
+        }
+    };
+
+    void Cancel() noexcept
+    {
+        auto expected = Arming;
+        if (m_cancelState.compare_exchange_strong(
+                expected, CancelledEarly, std::memory_order::acq_rel))
+        {
+            return;
+        }
+
+        if (static_cast<AwaiterT *>(this)->RemoveFromWaitList())
+        {
+            m_cancelled = true;
+            Resume();
+        }
+    }
+
+    static constexpr int Arming = 0;
+    static constexpr int Armed = 1;
+    static constexpr int CancelledEarly = 2;
+    static constexpr int Granted = 3;
+
+    std::atomic_int m_cancelState{Arming};
+    bool m_cancelled = false;
+    std::optional<std::stop_callback<OnCancel>> m_callback;
+};
+
+} // namespace Cortado::Detail
+
+#endif // CORTADO_DETAIL_CANCELLABLE_AWAITER_H
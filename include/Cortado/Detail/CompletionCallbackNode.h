@@ -0,0 +1,71 @@
+/// @file CompletionCallbackNode.h
+/// Continuation node which runs a callable instead of resuming a coroutine.
+///
+
+#ifndef CORTADO_DETAIL_COMPLETION_CALLBACK_NODE_H
+#define CORTADO_DETAIL_COMPLETION_CALLBACK_NODE_H
+
+// Cortado
+//
+#include <Cortado/Detail/CoroutineAwaiterQueueNode.h>
+
+// STL
+//
+#include <coroutine>
+#include <memory>
+#include <utility>
+
+namespace Cortado::Detail
+{
+
+/// @brief Continuation of a coroutine that is a plain callable. Installed in
+/// the promise's continuation slot like an awaiter, so the final awaiter
+/// runs it through the regular resumer hook; no coroutine frame is involved.
+/// Frees itself after the call.
+/// @tparam F Callable type, invoked without arguments. Must not throw: it
+/// runs inside `final_suspend`.
+///
+template <typename F>
+struct CompletionCallbackNode : CoroutineAwaiterQueueNode
+{
+    /// @brief Constructor.
+    /// @param fn Callable.
+    ///
+    template <typename U>
+    explicit CompletionCallbackNode(U &&fn) : Fn{std::forward<U>(fn)}
+    {
+    }
+
+    /// @brief Allocate a node for a coroutine.
+    /// @param fn Callable.
+    /// @param completed Coroutine whose completion triggers the call. It is
+    /// only used as a non-null marker and is never resumed.
+    /// @returns Node pointer.
+    ///
+    template <typename U>
+    static CompletionCallbackNode *Create(U &&fn,
+                                          std::coroutine_handle<> completed)
+    {
+        auto *node = new CompletionCallbackNode{std::forward<U>(fn)};
+        node->HandleToResume = completed;
+        node->HandleResumerFunc = &Run;
+        node->HandleResumerFuncContext = node;
+        return node;
+    }
+
+    F Fn;
+
+private:
+    static std::coroutine_handle<> Run(std::coroutine_handle<>,
+                                       void *context)
+    {
+        std::unique_ptr<CompletionCallbackNode> node{
+            static_cast<CompletionCallbackNode *>(context)};
+        node->Fn();
+        return std::noop_coroutine();
+    }
+};
+
+} // namespace Cortado::Detail
+
+#endif // CORTADO_DETAIL_COMPLETION_CALLBACK_NODE_H
@@ -28,8 +28,10 @@ struct CoroutineAwaiterQueueNode : AwaiterBase
 
     /// @brief Type-erased function pointer and context for resuming the next waiter.
     /// If HandleResumerFunc is set, it will be called with the handle of the coroutine to resume and the context when resuming.
+    /// It returns the coroutine the caller must continue with, e.g. the handle itself to resume it in place,
+    /// or `noop_coroutine` if it took care of resumption, e.g. by scheduling.
     ///
-    void (*HandleResumerFunc)(std::coroutine_handle<>, void *) = nullptr;
+    std::coroutine_handle<> (*HandleResumerFunc)(std::coroutine_handle<>, void *) = nullptr;
 
     /// @brief Type-erased context pointer for the resumer function, e.g. to hold a pointer to a scheduler.
     ///
@@ -61,7 +63,27 @@ struct CoroutineAwaiterQueueNode : AwaiterBase
         // If we have a handler, we are likely asked to schedule
         // next waiter on a scheduler.
         //
-        HandleResumerFunc(HandleToResume, HandleResumerFuncContext);
+        HandleResumerFunc(HandleToResume, HandleResumerFuncContext).resume();
+    }
+
+    /// @brief Same as Resume, but for callers that can resume the coroutine
+    /// by symmetric transfer, e.g. from `await_suspend`.
+    /// @returns The coroutine to transfer to, `noop_coroutine` if the
+    /// resumer took care of it.
+    ///
+    inline std::coroutine_handle<> ResumeByTransfer()
+    {
+        if (HandleToResume == nullptr)
+        {
+            return std::noop_coroutine();
+        }
+
+        if (HandleResumerFunc == nullptr)
+        {
+            return HandleToResume;
+        }
+
+        return HandleResumerFunc(HandleToResume, HandleResumerFuncContext);
     }
 };
 
@@ -69,11 +91,14 @@ struct CoroutineAwaiterQueueNode : AwaiterBase
 /// next awaiting coroutine asymmetrically.
 /// @param h Coroutine which takes the lock next.
 /// @param context Type-erased scheduler.
+/// @returns `noop_coroutine`, the scheduler resumes the coroutine.
 ///
 template <Concepts::CoroutineScheduler SchedulerT>
-inline void ScheduleNextWaiter(std::coroutine_handle<> h, void *context)
+inline std::coroutine_handle<> ScheduleNextWaiter(std::coroutine_handle<> h,
+                                                  void *context)
 {
     reinterpret_cast<SchedulerT *>(context)->Schedule(h);
+    return std::noop_coroutine();
 }
 } // namespace Cortado::Detail
 
@@ -8,15 +8,27 @@
 // Cortado
 //
 #include <Cortado/Concepts/AsyncStackTracing.h>
+#include <Cortado/Concepts/Cancellable.h>
+#include <Cortado/Concepts/DeadlineAware.h>
+#include <Cortado/Concepts/LazyStart.h>
+#include <Cortado/Concepts/NoExcept.h>
 #include <Cortado/Concepts/PreAndPostAction.h>
+#include <Cortado/Concepts/SharedResult.h>
 #include <Cortado/Concepts/TaskImpl.h>
 #include <Cortado/Detail/AsyncStackFrame.h>
 #include <Cortado/Detail/AtomicRefCount.h>
+#include <Cortado/Detail/CoroutineAwaiterQueueNode.h>
 #include <Cortado/Detail/CoroutineStorage.h>
 
 // STL
 //
 #include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <stop_token>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace Cortado::Detail
 {
@@ -47,34 +59,72 @@ struct AdditionalStorageHelper<T, false>
     using AdditionalStorageT = Nothing;
 };
 
-/// @brief Core promise class. Encapsulates refcounting,
-/// initial and final suspensions, exception handling and
-/// continuation hadnling.
+/// @brief Part of the promise which does not depend on the result type:
+/// lifetime tracking, initial and final suspensions, continuation handling
+/// and completion signalling. Instantiated once per TaskImpl, so that
+/// coroutines with different result types share this code.
+/// All of the shared state lives in a single atomic word: completion,
+/// detachment of the Task, error flag and continuation pointer. The frame is
+/// destroyed by whichever of the coroutine and the Task lets go last.
 /// @tparam T A class that defines custom types needed for
 /// coroutine strategy to function.
 /// See more at @link Cortado::Concepts::TaskImpl TaskImpl@endlink
-/// @tparam R Return value type.
 ///
-template <Concepts::TaskImpl T, typename R>
-struct CoroutinePromiseBase : AtomicRefCount<typename T::Atomic>
+template <Concepts::TaskImpl T>
+struct CoroutinePromiseStateBase
 {
     /// @brief Compiler contract: Initial suspension.
-    /// Never suspend at the beginning.
+    /// Never suspend at the beginning, unless the task is lazy.
     ///
-    std::suspend_never initial_suspend()
+    decltype(auto) initial_suspend() noexcept
     {
+        // Parent is the code that creates the coroutine, even if it starts
+        // later.
+        //
         if constexpr (Concepts::AsyncStackTracing<T>)
         {
             using FrameT = AsyncStackFrameT;
             m_asyncFrame.parentFrame = FrameT::GetCurrent();
-            FrameT::SetCurrent(&m_asyncFrame);
         }
 
-        return {};
+        struct InitialAwaiter
+        {
+            bool await_ready() noexcept
+            {
+                return !IsLazy;
+            }
+
+            void await_suspend(std::coroutine_handle<>) noexcept
+            {
+            }
+
+            void await_resume() noexcept
+            {
+                if constexpr (Concepts::AsyncStackTracing<T>)
+                {
+                    using FrameT = AsyncStackFrameT;
+                    FrameT::SetCurrent(&_this.m_asyncFrame);
+                }
+
+                // Lazy coroutine starts on the thread of whoever awaits it.
+                //
+                if constexpr (IsLazy && Concepts::HasAdditionalStorage<T>)
+                {
+                    T::OnBeforeResume(_this.m_additionalStorage);
+                }
+            }
+
+            CoroutinePromiseStateBase &_this;
+        };
+
+        return InitialAwaiter{*this};
     }
 
     /// @brief Compiler contract: Final suspension.
-    /// Do not suspend but call continuation if exists.
+    /// Suspend and transfer to continuation if exists, so that completion of
+    /// a chain of awaiting coroutines of any depth runs in constant stack
+    /// space. GCC only emits the transfer as a tail call with
+    /// `-foptimize-sibling-calls`, which is off at `-O0`.
     ///
     decltype(auto) final_suspend() noexcept
     {
@@ -85,7 +135,8 @@ struct CoroutinePromiseBase : AtomicRefCount<typename T::Atomic>
                 return false;
             }
 
-            bool await_suspend(std::coroutine_handle<>) noexcept
+            std::coroutine_handle<> await_suspend(
+                std::coroutine_handle<> h) noexcept
             {
                 // No _this.BeforeSuspend(); even if we suspend because
                 // this frame is outside of coroutine function body.
@@ -96,15 +147,53 @@ struct CoroutinePromiseBase : AtomicRefCount<typename T::Atomic>
                     FrameT::SetCurrent(_this.m_asyncFrame.parentFrame);
                 }
 
-                _this.m_completionEvent.Set();
-                auto next = std::coroutine_handle<>::from_address(
-                    _this.CallbackValueRendezvous());
-                if (next != nullptr)
+                if constexpr (Concepts::CompletionAction<T>)
+                {
+                    T::OnCompletion(_this.m_additionalStorage);
+                }
+
+                if constexpr (Concepts::HasEvent<T>)
                 {
-                    next.resume();
+                    _this.m_completionEvent.Set();
                 }
 
-                return _this.Release() > 0;
+                // Nothing of this frame can be touched after completion is
+                // published: the Task may destroy it right away.
+                //
+                const auto state = _this.Complete();
+
+                auto *node = GetContinuation(state);
+
+                // A detached frame is freed before its continuation runs,
+                // so that whoever it wakes up sees no frame left. The node
+                // lives elsewhere.
+                //
+                if (state & DetachedFlag)
+                {
+                    h.destroy();
+                }
+
+                // Shared result: resume every awaiter but the last one in
+                // place, and transfer to the last one.
+                //
+                if constexpr (IsShared)
+                {
+                    while (node != nullptr && node->Next != nullptr)
+                    {
+                        // Resumed awaiter may destroy the node.
+                        //
+                        auto *following = node->Next;
+                        node->Resume();
+                        node = following;
+                    }
+                }
+
+                if (node != nullptr)
+                {
+                    return node->ResumeByTransfer();
+                }
+
+                return std::noop_coroutine();
             }
 
             void await_resume() noexcept
@@ -113,31 +202,24 @@ struct CoroutinePromiseBase : AtomicRefCount<typename T::Atomic>
                 // destroyed
             }
 
-            CoroutinePromiseBase &_this;
+            CoroutinePromiseStateBase &_this;
         };
 
         return FinalAwaiter{*this};
     }
 
-    /// @brief Compiler contract: Actions on unhandled exception.
-    /// Call user-defined cathcer.
-    ///
-    void unhandled_exception()
-    {
-        m_storage.SetError(T::Catch());
-    }
-
     /// @brief Coroutine readiness flag.
     /// @returns true if coroutine has value/exception, false otherwise.
     ///
     bool Ready()
     {
-        return m_completionEvent.IsSet();
+        return m_state.load(std::memory_order::acquire) & CompletedFlag;
     }
 
     /// @brief Wait completion event to be signaled.
     ///
     void Wait()
+        requires Concepts::HasEvent<T>
     {
         m_completionEvent.Wait();
     }
@@ -146,34 +228,183 @@ struct CoroutinePromiseBase : AtomicRefCount<typename T::Atomic>
     /// @param timeToWaitMs Time to wait in milliseconds.
     ///
     bool WaitFor(unsigned long timeToWaitMs)
+        requires Concepts::HasEvent<T>
     {
         return m_completionEvent.WaitFor(timeToWaitMs);
     }
 
     /// @brief Set next coroutine to execute once this one is completed.
-    /// @param h Handle to a coroutine which must be resumed once this
+    /// Coroutines with a shared result keep a stack of such nodes linked
+    /// through their `Next` field.
+    /// @param node Awaiter of a coroutine which must be resumed once this
+    /// coroutine is completed. Its resumer, if any, decides where the
+    /// coroutine is resumed.
+    /// @returns true if the node was stored and will be resumed on
+    /// completion, false if this coroutine has already completed and the
+    /// caller must continue by itself.
+    ///
+    bool SetContinuation(CoroutineAwaiterQueueNode *node)
+    {
+        auto state = m_state.load(std::memory_order::acquire);
+
+        do
+        {
+            if (state & CompletedFlag)
+            {
+                return false;
+            }
+
+            if constexpr (IsShared)
+            {
+                node->Next = GetContinuation(state);
+            }
+        } while (!m_state.compare_exchange_weak(
+            state,
+            (state & FlagsMask) | PackContinuation(node),
+            std::memory_order::acq_rel,
+            std::memory_order::acquire));
+
+        return true;
+    }
+
+    /// @brief Mark lazy coroutine as started.
+    /// @returns true if the caller must resume it, false if it has already
+    /// been started.
+    ///
+    bool TryStart()
+        requires IsLazy
+    {
+        return !std::exchange(m_lazyState.Started, true);
+    }
+
+    /// @brief Set continuation of a lazy coroutine that is not started yet.
+    /// Nothing else can touch the state before the coroutine runs, so this
+    /// is a plain store.
+    /// @param node Awaiter of a coroutine which must be resumed once this
     /// coroutine is completed.
-    /// @returns true if suspension of the current coroutine required, false
-    /// otherwise.
     ///
-    bool SetContinuation(std::coroutine_handle<> h)
+    void SetContinuationBeforeStart(CoroutineAwaiterQueueNode *node)
+        requires IsLazy
     {
-        auto expectedState = NoCompletionState;
+        m_state.store(PackContinuation(node), std::memory_order::relaxed);
+        m_lazyState.AwaitedBeforeStart = true;
+    }
 
-        auto desiredState =
-            reinterpret_cast<Concepts::AtomicPrimitive>(h.address());
+    /// @brief Set continuation and release the Task's hold on the frame in
+    /// one step, so that the coroutine frees its frame before it runs the
+    /// continuation.
+    /// @param node Continuation node which outlives the frame.
+    /// @returns true if the coroutine will run the node on completion, false
+    /// if it has already completed and the caller must destroy the frame and
+    /// run the node by itself.
+    ///
+    bool DetachWithContinuation(CoroutineAwaiterQueueNode *node)
+        requires(!Concepts::SharedResult<T>)
+    {
+        auto state = m_state.load(std::memory_order::acquire);
 
-        if (m_continuation.compare_exchange_strong(expectedState, desiredState))
+        do
         {
-            // Successfully stored callback first
-            return true;
+            if (state & CompletedFlag)
+            {
+                return false;
+            }
+        } while (!m_state.compare_exchange_weak(
+            state,
+            (state & FlagsMask) | DetachedFlag | PackContinuation(node),
+            std::memory_order::acq_rel,
+            std::memory_order::acquire));
+
+        return true;
+    }
+
+    /// @brief Register one more owner of a shared result.
+    ///
+    void AddOwner()
+        requires IsShared
+    {
+        m_owners.Owners.AddRef();
+    }
+
+    /// @brief Release the Task's hold on the frame.
+    /// @returns true if the coroutine has already completed, or was never
+    /// started, and the caller must destroy the frame, false if the coroutine
+    /// or another owner will do it.
+    ///
+    bool Detach()
+    {
+        if constexpr (IsShared)
+        {
+            if (m_owners.Owners.Release() != 0)
+            {
+                return false;
+            }
         }
-        else if (expectedState == ValueCompletionState)
+
+        if constexpr (IsLazy)
         {
-            h.resume();
+            if (!m_lazyState.Started)
+            {
+                return true;
+            }
+        }
+
+        auto state = m_state.load(std::memory_order::acquire);
+        while (!m_state.compare_exchange_weak(state,
+                                              state | DetachedFlag,
+                                              std::memory_order::acq_rel,
+                                              std::memory_order::acquire))
+        {
+        }
+
+        return state & CompletedFlag;
+    }
+
+    /// @brief Check if coroutine completed with an error. Only meaningful
+    /// once the coroutine is completed.
+    /// @returns true if storage holds an error, false otherwise.
+    ///
+    bool HasError()
+    {
+        if constexpr (IsNoExcept)
+        {
+            return false;
         }
 
-        return false;
+        return m_state.load(std::memory_order::acquire) & ErrorFlag;
+    }
+
+    /// @brief Cancellation token the coroutine was created with.
+    ///
+    const std::stop_token &GetCancellationToken()
+        requires Concepts::Cancellable<T>
+    {
+        return T::GetCancellationToken(m_additionalStorage);
+    }
+
+    /// @brief Deadline and priority the coroutine was created with.
+    ///
+    const SchedulingAttributes &GetSchedulingAttributes()
+        requires Concepts::DeadlineAware<T>
+    {
+        return T::GetSchedulingAttributes(m_additionalStorage);
+    }
+
+    /// @brief Call user-defined behavior over user-defined storage right
+    /// before the coroutine is handed over to a scheduler.
+    /// @returns Guard to keep alive until the scheduler has taken the
+    /// coroutine.
+    ///
+    auto HandOver()
+    {
+        if constexpr (Concepts::HandOverAction<T>)
+        {
+            return T::OnHandOver(m_additionalStorage);
+        }
+        else
+        {
+            return std::monostate{};
+        }
     }
 
     /// @brief Call user-defined behavior over user-defined storage
@@ -212,10 +443,20 @@ struct CoroutinePromiseBase : AtomicRefCount<typename T::Atomic>
         }
     }
 
+    /// @brief Coroutine does not run until it is awaited or waited for.
+    ///
+    static constexpr bool IsLazy = Concepts::LazyStart<T>;
+
+    /// @brief Coroutine result may be awaited by many coroutines at once.
+    ///
+    static constexpr bool IsShared = Concepts::SharedResult<T>;
+
+    /// @brief Coroutine never completes with an error.
+    ///
+    static constexpr bool IsNoExcept = Concepts::NoExcept<T>;
+
 protected:
-    using ExceptionT = typename T::Exception;
     using AtomicT = typename T::Atomic;
-    using EventT = typename T::Event;
 
     static constexpr bool HasAsyncStackTracing = Concepts::AsyncStackTracing<T>;
     static constexpr bool HasUserStroage = Concepts::HasAdditionalStorage<T>;
@@ -240,20 +481,75 @@ protected:
     using AdditionalStorageT =
         AdditionalStorageHelper<T, HasUserStroage>::AdditionalStorageT;
 
-    static constexpr Concepts::AtomicPrimitive NoCompletionState = 0;
-    static constexpr Concepts::AtomicPrimitive ValueCompletionState = 1;
+    struct NoEvent {};
 
-    /// @brief Essential storage - stores value or exception.
+    template <typename U, bool Enabled>
+    struct EventHelper
+    {
+        using Type = NoEvent;
+    };
+
+    template <typename U>
+    struct EventHelper<U, true>
+    {
+        using Type = typename U::Event;
+    };
+
+    using EventT = typename EventHelper<T, Concepts::HasEvent<T>>::Type;
+
+    struct EagerState {};
+
+    struct LazyState
+    {
+        bool Started = false;
+
+        /// @brief Continuation was set before start, so its owner stays
+        /// suspended until completion.
+        ///
+        bool AwaitedBeforeStart = false;
+    };
+
+    using LazyStateT = std::conditional_t<IsLazy, LazyState, EagerState>;
+
+    struct SingleOwner {};
+
+    struct SharedOwners
+    {
+        AtomicRefCount<AtomicT> Owners;
+    };
+
+    using OwnersT = std::conditional_t<IsShared, SharedOwners, SingleOwner>;
+
+    /// @brief Coroutine has reached final suspension.
+    ///
+    static constexpr Concepts::AtomicPrimitive CompletedFlag = 1;
+
+    /// @brief Task no longer refers to the frame.
+    ///
+    static constexpr Concepts::AtomicPrimitive DetachedFlag = 2;
+
+    /// @brief Storage holds an error rather than a value.
+    ///
+    static constexpr Concepts::AtomicPrimitive ErrorFlag = 4;
+
+    static constexpr Concepts::AtomicPrimitive FlagsMask = 7;
+
+    /// @brief 64-bit pointers have their low bits free thanks to alignment,
+    /// 32-bit ones are kept in the upper half of the word.
     ///
-    CoroutineStorage<R, ExceptionT, AtomicT> m_storage;
+    static constexpr int ContinuationShift = sizeof(void *) < 8 ? 32 : 0;
 
-    /// @brief Completion event.
+    static_assert(ContinuationShift != 0 ||
+                      alignof(CoroutineAwaiterQueueNode) > FlagsMask,
+                  "Continuation pointer bits overlap with state flags");
+
+    /// @brief Shared state: flags and continuation.
     ///
-    EventT m_completionEvent;
+    AtomicT m_state{0};
 
-    /// @brief Continuation - the coroutine that awaits for this one, if any.
+    /// @brief Optional completion event for synchronous waits.
     ///
-    AtomicT m_continuation = 0;
+    [[no_unique_address]] EventT m_completionEvent;
 
     /// @brief Optional user storage.
     ///
@@ -263,41 +559,177 @@ protected:
     ///
     [[no_unique_address]] AsyncStackFrameT m_asyncFrame;
 
-    /// @brief Rethrows exception from result storage, if any.
+    /// @brief Start flag of lazy coroutines. Only the owner of the Task
+    /// starts the coroutine, so it is not atomic.
     ///
-    void RethrowError()
+    [[no_unique_address]] LazyStateT m_lazyState;
+
+    /// @brief Number of tasks which share the result.
+    ///
+    [[no_unique_address]] OwnersT m_owners;
+
+    /// @brief Flag that the storage holds an error.
+    ///
+    void MarkError()
     {
-        if (m_storage.GetHeldValueType() == HeldValue::Error)
+        // Only the awaiter may race with us here, and it only adds the
+        // continuation.
+        //
+        auto state = m_state.load(std::memory_order::relaxed);
+        while (!m_state.compare_exchange_weak(state,
+                                              state | ErrorFlag,
+                                              std::memory_order::relaxed,
+                                              std::memory_order::relaxed))
         {
-            T::Rethrow(std::move(m_storage.UnsafeError()));
         }
     }
 
-private:
-    /// @brief Handle race-condition between a thread that sets value and a
-    /// thread that sets continuation. If value thread succeeds, we return
-    /// nullptr. Otherwise we return pointer to continuation (i.e. continuation
-    /// was set after coroutine completion).
-    /// @returns Continuation or nullptr;
+    /// @brief Publish completion. This is the only atomic operation on the
+    /// completion path.
+    /// @returns State before completion.
     ///
-    void *CallbackValueRendezvous()
+    Concepts::AtomicPrimitive Complete()
     {
-        auto expectedState = NoCompletionState;
+        if constexpr (IsLazy && !IsShared)
+        {
+            // The only owner of the Task awaits it and stays suspended until
+            // it is resumed from here, so nothing can race with us.
+            //
+            if (m_lazyState.AwaitedBeforeStart)
+            {
+                auto state = m_state.load(std::memory_order::relaxed);
+                m_state.store(state | CompletedFlag,
+                              std::memory_order::release);
+                return state;
+            }
+        }
+
+        auto state = m_state.load(std::memory_order::relaxed);
+        while (!m_state.compare_exchange_weak(state,
+                                              state | CompletedFlag,
+                                              std::memory_order::acq_rel,
+                                              std::memory_order::relaxed))
+        {
+        }
+
+        return state;
+    }
 
-        auto desiredState = ValueCompletionState;
+    /// @brief Pack continuation pointer into state bits.
+    ///
+    static Concepts::AtomicPrimitive PackContinuation(
+        CoroutineAwaiterQueueNode *node)
+    {
+        return static_cast<Concepts::AtomicPrimitive>(
+                   reinterpret_cast<std::uintptr_t>(node))
+               << ContinuationShift;
+    }
+
+    /// @brief Unpack continuation pointer from state bits.
+    ///
+    static CoroutineAwaiterQueueNode *GetContinuation(
+        Concepts::AtomicPrimitive state)
+    {
+        return reinterpret_cast<CoroutineAwaiterQueueNode *>(
+            static_cast<std::uintptr_t>(state >> ContinuationShift) &
+            ~static_cast<std::uintptr_t>(ContinuationShift ? 0 : FlagsMask));
+    }
 
-        if (m_continuation.compare_exchange_strong(expectedState, desiredState))
+    /// @brief Decode what the storage holds.
+    ///
+    static HeldValue GetHeldValueType(Concepts::AtomicPrimitive state)
+    {
+        if (!(state & CompletedFlag))
         {
-            // Successfully stored value first
-            return nullptr;
+            return HeldValue::None;
         }
-        else if (expectedState > 1)
+
+        return (state & ErrorFlag) ? HeldValue::Error : HeldValue::Value;
+    }
+};
+
+/// @brief Core promise class. Adds result storage and error handling, the
+/// only parts that depend on the result type, to the shared state.
+/// @tparam T A class that defines custom types needed for
+/// coroutine strategy to function.
+/// See more at @link Cortado::Concepts::TaskImpl TaskImpl@endlink
+/// @tparam R Return value type.
+///
+template <Concepts::TaskImpl T, typename R>
+struct CoroutinePromiseBase : CoroutinePromiseStateBase<T>
+{
+    /// @brief Destructor. Destroys result, the coroutine is completed by
+    /// now.
+    ///
+    ~CoroutinePromiseBase()
+    {
+        m_storage.Destroy(StateBaseT::GetHeldValueType(
+            this->m_state.load(std::memory_order::acquire)));
+    }
+
+    /// @brief Compiler contract: Actions on unhandled exception.
+    /// Call user-defined cathcer, or terminate if the TaskImpl is
+    /// @link Cortado::Concepts::NoExcept NoExcept@endlink.
+    ///
+    void unhandled_exception()
+    {
+        if constexpr (StateBaseT::IsNoExcept)
+        {
+            std::terminate();
+        }
+        else
         {
-            // Callback was already set, return to final_suspend
-            return reinterpret_cast<void *>(expectedState);
+            SetError();
         }
+    }
 
-        return nullptr;
+    /// @brief Move stored error out without rethrowing it. Only valid if
+    /// `HasError` returned true.
+    /// @returns Stored error.
+    ///
+    typename T::Exception TakeError()
+    {
+        return std::move(m_storage.UnsafeError());
+    }
+
+protected:
+    using StateBaseT = CoroutinePromiseStateBase<T>;
+    using ExceptionT = typename T::Exception;
+
+    /// @brief Essential storage - stores value or exception.
+    ///
+    CoroutineStorage<R, ExceptionT> m_storage;
+
+    /// @brief Rethrows exception from result storage, if any. A shared
+    /// error is copied, so that every awaiter gets it.
+    ///
+    void RethrowError()
+    {
+        if constexpr (StateBaseT::IsNoExcept)
+        {
+            return;
+        }
+
+        if (this->HasError())
+        {
+            if constexpr (StateBaseT::IsShared)
+            {
+                T::Rethrow(ExceptionT{m_storage.UnsafeError()});
+            }
+            else
+            {
+                T::Rethrow(std::move(m_storage.UnsafeError()));
+            }
+        }
+    }
+
+private:
+    /// @brief Store caught exception and flag it.
+    ///
+    void SetError()
+    {
+        m_storage.SetError(T::Catch());
+        this->MarkError();
     }
 };
 
@@ -321,14 +753,22 @@ struct CoroutinePromiseBaseWithValue : CoroutinePromiseBase<T, R>
     }
 
     /// @brief Get stored value or rethrow exception.
-    /// @returns Value from storage.
+    /// @returns Value from storage, moved out unless it is shared.
     /// @throws Exception from @link Cortado::Concepts::ErrorHandler
     /// ErrorHandler@endlink's `Rethrow` function.
     ///
     decltype(auto) Get()
     {
         this->RethrowError();
-        return std::move(this->m_storage.UnsafeValue());
+
+        if constexpr (CoroutinePromiseBase<T, R>::IsShared)
+        {
+            return std::as_const(this->m_storage.UnsafeValue());
+        }
+        else
+        {
+            return std::move(this->m_storage.UnsafeValue());
+        }
     }
 };
 
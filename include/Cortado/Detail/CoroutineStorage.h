@@ -9,6 +9,12 @@
 //
 #include <Cortado/Concepts/Atomic.h>
 
+// STL
+//
+#include <cstddef>
+#include <new>
+#include <utility>
+
 namespace Cortado::Detail
 {
 
@@ -46,13 +52,13 @@ enum class HeldValue : Concepts::AtomicPrimitive
 };
 
 /// @brief Coroutine value/exception storage class. It is as primitive as
-/// possible, only manages get-set operations on value/error and provides
-/// querying current state.
+/// possible, only manages get-set operations on value/error. It does not
+/// track what it holds: the owner keeps that in its own state and passes it
+/// to `Destroy`.
 /// @tparam R Value type.
 /// @tparam E Exception type.
-/// @tparam Atomic Implementation of atomic primitive.
 ///
-template <typename R, typename E, Concepts::Atomic Atomic>
+template <typename R, typename E>
 struct CoroutineStorage
 {
 public:
@@ -76,13 +82,6 @@ public:
     ///
     CoroutineStorage &operator=(CoroutineStorage &&) = delete;
 
-    /// @brief Destructor. Destructs current value/exception if any.
-    ///
-    ~CoroutineStorage()
-    {
-        DestroyResult();
-    }
-
     /// @brief Constructs value in storage.
     /// @tparam U Same as R or convertible to it.
     ///
@@ -90,8 +89,6 @@ public:
     void SetValue(U &&u)
     {
         ::new (&m_resultStorage[0]) R{std::forward<U>(u)};
-
-        m_heldValue = static_cast<Concepts::AtomicPrimitive>(HeldValue::Value);
     }
 
     /// @brief Constructs exception in storage.
@@ -100,17 +97,6 @@ public:
     void SetError(E &&e)
     {
         ::new (&m_resultStorage[0]) E{std::forward<E>(e)};
-
-        m_heldValue = static_cast<Concepts::AtomicPrimitive>(HeldValue::Error);
-    }
-
-    /// @brief Get current storage state.
-    /// @returns Storage state value.
-    ///
-    HeldValue GetHeldValueType() const
-    {
-        Concepts::AtomicPrimitive valueType = m_heldValue;
-        return static_cast<HeldValue>(valueType);
     }
 
     /// @brief Get reference to value without checking current state.
@@ -118,7 +104,7 @@ public:
     ///
     R &UnsafeValue()
     {
-        return *reinterpret_cast<R *>(&m_resultStorage[0]);
+        return *std::launder(reinterpret_cast<R *>(&m_resultStorage[0]));
     }
 
     /// @brief Get reference to exception without checking current state.
@@ -126,25 +112,15 @@ public:
     ///
     E &UnsafeError()
     {
-        return *reinterpret_cast<E *>(&m_resultStorage[0]);
+        return *std::launder(reinterpret_cast<E *>(&m_resultStorage[0]));
     }
 
-private:
-    /// @brief Current state value.
-    ///
-    Atomic m_heldValue{static_cast<Concepts::AtomicPrimitive>(HeldValue::None)};
-
-    /// @brief Value/exception storage.
-    ///
-    alignas(AlignOfResultStorage<R, E>()) std::byte
-        m_resultStorage[SizeOfResultStorage<R, E>()] = {};
-
     /// @brief Call destructor for stored object if any.
+    /// @param held What the storage currently holds.
     ///
-    void DestroyResult()
+    void Destroy(HeldValue held)
     {
-        Concepts::AtomicPrimitive valueType = m_heldValue;
-        switch (static_cast<HeldValue>(valueType))
+        switch (held)
         {
         case HeldValue::Value:
             UnsafeValue().~R();
@@ -156,6 +132,12 @@ private:
             break;
         }
     }
+
+private:
+    /// @brief Value/exception storage.
+    ///
+    alignas(AlignOfResultStorage<R, E>()) std::byte
+        m_resultStorage[SizeOfResultStorage<R, E>()];
 };
 
 } // namespace Cortado::Detail
@@ -0,0 +1,42 @@
+/// @file CpuRelax.h
+/// Spin-wait hint for busy loops.
+///
+
+#ifndef CORTADO_DETAIL_CPU_RELAX_H
+#define CORTADO_DETAIL_CPU_RELAX_H
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+#include <intrin.h>
+#endif
+
+// STL
+//
+#include <thread>
+
+namespace Cortado::Detail
+{
+
+/// @brief Tell the CPU we are spinning: `pause` on x86, `yield` on ARM.
+/// Lets the sibling hyper-thread run and saves power without leaving the
+/// core. Falls back to yielding the thread on other architectures.
+///
+inline void CpuRelax() noexcept
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_pause();
+#elif defined(_MSC_VER) && (defined(_M_ARM64) || defined(_M_ARM))
+    __yield();
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#else
+    std::this_thread::yield();
+#endif
+}
+
+} // namespace Cortado::Detail
+
+#endif // CORTADO_DETAIL_CPU_RELAX_H
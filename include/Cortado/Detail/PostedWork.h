@@ -0,0 +1,230 @@
+/// @file PostedWork.h
+/// Type-erased fire-and-forget job for scheduler queues.
+///
+
+#ifndef CORTADO_DETAIL_POSTED_WORK_H
+#define CORTADO_DETAIL_POSTED_WORK_H
+
+// STL
+//
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Cortado::Detail
+{
+
+/// @brief Heap node for a callable that does not fit into a queue slot, or
+/// for schedulers that can only pass a single pointer to their callback.
+/// @tparam F Callable type.
+///
+template <typename F>
+struct PostedCallableNode
+{
+    F Fn;
+
+    /// @brief Allocate a node.
+    /// @param fn Callable to store.
+    /// @returns Type-erased node pointer.
+    ///
+    template <typename U>
+    static void *Create(U &&fn)
+    {
+        return new PostedCallableNode{std::forward<U>(fn)};
+    }
+
+    /// @brief Invoke and free a node created by `Create`.
+    /// @param node Type-erased node pointer.
+    ///
+    static void InvokeAndDestroy(void *node)
+    {
+        std::unique_ptr<PostedCallableNode> owned{
+            static_cast<PostedCallableNode *>(node)};
+        owned->Fn();
+    }
+};
+
+/// @brief Move-only job stored by value in scheduler queues. Callables up to
+/// `InlineSize` bytes (a coroutine handle, a lambda capturing a few
+/// pointers) live inside the job itself, so posting them costs no heap
+/// allocation; larger callables are moved into a `PostedCallableNode`.
+///
+class PostedWork
+{
+public:
+    /// @brief Size of in-place callable storage.
+    ///
+    static constexpr std::size_t InlineSize = 48;
+
+    /// @brief Check if a callable is stored in place.
+    /// @tparam F Callable type.
+    ///
+    template <typename F>
+    static constexpr bool FitsInline =
+        sizeof(F) <= InlineSize &&
+        alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    /// @brief Constructs an empty job.
+    ///
+    PostedWork() = default;
+
+    /// @brief Constructs a job that resumes a coroutine.
+    /// @param h Coroutine to resume.
+    ///
+    explicit PostedWork(std::coroutine_handle<> h) :
+        PostedWork{[h] { h.resume(); }}
+    {
+    }
+
+    /// @brief Constructs a job from a callable.
+    /// @tparam F Callable type.
+    /// @param fn Callable to invoke once.
+    ///
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, PostedWork> &&
+                 std::invocable<std::remove_cvref_t<F> &>)
+    explicit PostedWork(F &&fn)
+    {
+        using FnT = std::remove_cvref_t<F>;
+
+        if constexpr (FitsInline<FnT>)
+        {
+            ::new (static_cast<void *>(m_storage)) FnT{std::forward<F>(fn)};
+            m_ops = &InlineOps<FnT>;
+        }
+        else
+        {
+            ::new (static_cast<void *>(m_storage))
+                void *{PostedCallableNode<FnT>::Create(std::forward<F>(fn))};
+            m_ops = &HeapOps<FnT>;
+        }
+    }
+
+    /// @brief Move constructor.
+    ///
+    PostedWork(PostedWork &&other) noexcept : m_ops{other.m_ops}
+    {
+        if (m_ops != nullptr)
+        {
+            m_ops->Move(m_storage, other.m_storage);
+            other.m_ops = nullptr;
+        }
+    }
+
+    /// @brief Move assignment.
+    ///
+    PostedWork &operator=(PostedWork &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+
+            m_ops = std::exchange(other.m_ops, nullptr);
+            if (m_ops != nullptr)
+            {
+                m_ops->Move(m_storage, other.m_storage);
+            }
+        }
+
+        return *this;
+    }
+
+    /// @brief Non-copyable.
+    ///
+    PostedWork(const PostedWork &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    PostedWork &operator=(const PostedWork &) = delete;
+
+    /// @brief Destructor. Destroys the callable if it was not invoked.
+    ///
+    ~PostedWork()
+    {
+        Reset();
+    }
+
+    /// @brief Invoke the callable and release it. The job is empty after.
+    ///
+    void operator()()
+    {
+        const Ops *ops = std::exchange(m_ops, nullptr);
+        ops->InvokeAndDestroy(m_storage);
+    }
+
+    /// @brief Check if job holds a callable.
+    ///
+    explicit operator bool() const noexcept
+    {
+        return m_ops != nullptr;
+    }
+
+private:
+    /// @brief Type-erased operations over the storage.
+    ///
+    struct Ops
+    {
+        void (*InvokeAndDestroy)(void *storage);
+        void (*Move)(void *dst, void *src) noexcept;
+        void (*Destroy)(void *storage) noexcept;
+    };
+
+    template <typename FnT>
+    static constexpr Ops InlineOps{
+        [](void *storage)
+        {
+            FnT &fn = *std::launder(static_cast<FnT *>(storage));
+
+            struct Guard
+            {
+                FnT &Fn;
+                ~Guard()
+                {
+                    Fn.~FnT();
+                }
+            } guard{fn};
+
+            fn();
+        },
+        [](void *dst, void *src) noexcept
+        {
+            FnT &from = *std::launder(static_cast<FnT *>(src));
+            ::new (dst) FnT{std::move(from)};
+            from.~FnT();
+        },
+        [](void *storage) noexcept
+        { std::launder(static_cast<FnT *>(storage))->~FnT(); }};
+
+    template <typename FnT>
+    static constexpr Ops HeapOps{
+        [](void *storage)
+        {
+            PostedCallableNode<FnT>::InvokeAndDestroy(
+                *static_cast<void **>(storage));
+        },
+        [](void *dst, void *src) noexcept
+        { ::new (dst) void *{*static_cast<void **>(src)}; },
+        [](void *storage) noexcept
+        { delete static_cast<PostedCallableNode<FnT> *>(
+              *static_cast<void **>(storage)); }};
+
+    void Reset() noexcept
+    {
+        if (m_ops != nullptr)
+        {
+            std::exchange(m_ops, nullptr)->Destroy(m_storage);
+        }
+    }
+
+    alignas(std::max_align_t) std::byte m_storage[InlineSize];
+    const Ops *m_ops{nullptr};
+};
+
+} // namespace Cortado::Detail
+
+#endif // CORTADO_DETAIL_POSTED_WORK_H
@@ -3,7 +3,17 @@
 
 // Cortado
 //
+#include <Cortado/Concepts/AwaitTransform.h>
+#include <Cortado/Concepts/Sender.h>
 #include <Cortado/Detail/CoroutinePromiseBase.h>
+#include <Cortado/Detail/SenderAwaiter.h>
+
+// STL
+//
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace Cortado
 {
@@ -97,8 +107,7 @@ struct PromiseType : Detail::CoroutinePromiseBaseWithValue<T, R>
     [[nodiscard]] static void *operator new(std::size_t size)
         requires std::is_default_constructible_v<Allocator>
     {
-        Allocator a;
-        return AllocateFrame(size, a);
+        return AllocateFrame(size, Allocator{});
     }
 
     /// @brief Compiler contract: Defining `delete` that uses custom allocator.
@@ -110,13 +119,38 @@ struct PromiseType : Detail::CoroutinePromiseBaseWithValue<T, R>
     {
         std::byte *rawMemory = static_cast<std::byte *>(ptr);
 
+        // Stateless allocator is not stored, make a new one
+        //
+        if constexpr (!StoresAllocator)
+        {
+            Allocator allocator;
+            allocator.deallocate(rawMemory, size);
+            return;
+        }
+
         // Offset back to allocator storage
         //
         rawMemory -= AllocatorSizeAlignedByPromise();
 
+        // Restore total allocation size
+        //
+        const std::size_t totalAllocationSize =
+            AllocatorSizeAlignedByPromise() + size;
+
+        // Handle is trivially copyable, just read it
+        //
+        if constexpr (Concepts::FrameHandleAllocator<Allocator>)
+        {
+            const auto handle =
+                *std::launder(reinterpret_cast<StoredAllocatorT *>(rawMemory));
+            Allocator::Deallocate(handle, rawMemory, totalAllocationSize);
+            return;
+        }
+
         // Cast to allocator pointer
         //
-        Allocator *allocatorPtr = reinterpret_cast<Allocator *>(rawMemory);
+        Allocator *allocatorPtr =
+            std::launder(reinterpret_cast<Allocator *>(rawMemory));
 
         // Extract allocator from storage
         //
@@ -138,11 +172,6 @@ struct PromiseType : Detail::CoroutinePromiseBaseWithValue<T, R>
         //
         allocatorPtr->~Allocator();
 
-        // Restore total allocation size
-        //
-        const std::size_t totalAllocationSize =
-            AllocatorSizeAlignedByPromise() + size;
-
         allocator.deallocate(rawMemory, totalAllocationSize);
     }
 
@@ -151,22 +180,46 @@ struct PromiseType : Detail::CoroutinePromiseBaseWithValue<T, R>
     ///
     Task<R, T> get_return_object();
 
-    /// @brief Compiler contract: Core checkpoint for all awaiters
+    /// @brief Compiler contract: Core checkpoint for all awaiters. Hands the
+    /// operand to the TaskImpl's `AwaitTransform` if there is one, otherwise
+    /// forwards it as is.
     /// @returns Awaitable that is returned by respective `co_await` operator.
     ///
     template <typename U>
-    U &&await_transform(U &&awaitable) noexcept
+    decltype(auto) await_transform(U &&awaitable) noexcept(
+        !Concepts::AwaitTransform<T>)
     {
-        return static_cast<U &&>(awaitable);
+        if constexpr (Concepts::AwaitTransform<T>)
+        {
+            return T::AwaitTransform(static_cast<U &&>(awaitable));
+        }
+        else
+        {
+            return static_cast<U &&>(awaitable);
+        }
+    }
+
+    /// @brief Compiler contract: Senders are awaited through an awaiter that
+    /// holds their operation state. The awaiter is not movable, so it is not
+    /// passed to `AwaitTransform`.
+    /// @returns SenderAwaiter.
+    ///
+    template <Concepts::Sender U>
+        requires std::is_rvalue_reference_v<U &&>
+    SenderAwaiter<std::remove_cvref_t<U>> await_transform(U &&sender)
+    {
+        return SenderAwaiter<std::remove_cvref_t<U>>{std::move(sender)};
     }
 
 private:
     /// @brief Helper for frame allocation.
     /// @param size Size of aligned frame requested by compiler.
-    /// @param a Allocator instance to use for allocation.
+    /// @param a Allocator instance to use for allocation. Temporary is moved
+    /// into the frame, so that a ref-counted handle is not copied.
     /// @returns Pointer to aligned frame start.
     ///
-    inline static void *AllocateFrame(std::size_t size, Allocator &a)
+    template <typename A>
+    inline static void *AllocateFrame(std::size_t size, A &&a)
     {
         // Total allocation size includes:
         // --------------------------------------
@@ -185,9 +238,25 @@ private:
             return nullptr;
         }
 
-        // Copy-place the allocator
+        if constexpr (!StoresAllocator)
+        {
+            return rawPtr;
+        }
+
+        // Copy-place the allocator, or only its handle
         //
-        ::new (rawPtr) Allocator{a};
+        if constexpr (Concepts::FrameHandleAllocator<Allocator>)
+        {
+            ::new (rawPtr) StoredAllocatorT{a.GetFrameHandle()};
+        }
+        else if constexpr (std::is_constructible_v<Allocator, A &&>)
+        {
+            ::new (rawPtr) Allocator{std::forward<A>(a)};
+        }
+        else
+        {
+            ::new (rawPtr) Allocator{a};
+        }
 
         // Advance pointer to 'after allocator' position and return
         //
@@ -196,20 +265,50 @@ private:
         return rawMemory + AllocatorSizeAlignedByPromise();
     }
 
+    /// @brief Stateless allocators are default-constructed on deallocation
+    /// instead of taking space in front of every frame.
+    ///
+    static constexpr bool StoresAllocator =
+        !Concepts::StatelessAllocator<Allocator>;
+
+    template <typename A, bool FHasHandle>
+    struct StoredAllocatorHelper
+    {
+        using Type = A;
+    };
+
+    template <typename A>
+    struct StoredAllocatorHelper<A, true>
+    {
+        using Type = typename A::FrameHandle;
+    };
+
+    /// @brief What is kept in front of the frame: the allocator itself or
+    /// its frame handle.
+    ///
+    using StoredAllocatorT = typename StoredAllocatorHelper<
+        Allocator,
+        Concepts::FrameHandleAllocator<Allocator>>::Type;
+
     /// @brief Helper for alignment calculations.
     /// Canonical alignment formula to ensure allocator is properly aligned
     /// @returns Aligned size of Allocator.
     ///
     inline static constexpr std::size_t AllocatorSizeAlignedByPromise()
     {
+        if constexpr (!StoresAllocator)
+        {
+            return 0;
+        }
+
         constexpr std::size_t frameAlignment = alignof(PromiseType);
-        constexpr std::size_t allocatorAlignment = alignof(Allocator);
+        constexpr std::size_t allocatorAlignment = alignof(StoredAllocatorT);
 
         constexpr std::size_t finalAllocatorAlignment =
             allocatorAlignment > frameAlignment ? allocatorAlignment
                                                 : frameAlignment;
 
-        return (sizeof(Allocator) + (finalAllocatorAlignment - 1)) &
+        return (sizeof(StoredAllocatorT) + (finalAllocatorAlignment - 1)) &
                ~(finalAllocatorAlignment - 1);
     }
 };
@@ -0,0 +1,149 @@
+/// @file SenderAwaiter.h
+/// Awaiter that lets a Task `co_await` a sender directly.
+///
+
+#ifndef CORTADO_DETAIL_SENDER_AWAITER_H
+#define CORTADO_DETAIL_SENDER_AWAITER_H
+
+// Cortado
+//
+#include <Cortado/AwaiterBase.h>
+#include <Cortado/Concepts/Sender.h>
+#include <Cortado/OperationStopped.h>
+
+// STL
+//
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace Cortado::Detail
+{
+
+/// @brief Placeholder for a value of senders that complete without one.
+///
+struct VoidValue
+{
+};
+
+/// @brief Awaiter which connects a sender to a receiver that resumes the
+/// awaiting coroutine. The operation state lives inside the awaiter, i.e. in
+/// the awaiting coroutine frame, so awaiting a sender allocates nothing.
+/// @tparam S Sender type.
+///
+template <Concepts::Sender S>
+struct SenderAwaiter : AwaiterBase
+{
+    using ValueT = typename S::value_type;
+
+    /// @brief Constructor. Connects the sender.
+    /// @param sender Sender to await.
+    ///
+    explicit SenderAwaiter(S &&sender) :
+        m_operation{std::move(sender).connect(AwaitingReceiver{this})}
+    {
+    }
+
+    /// @brief Non-copyable and non-movable: the receiver points to it.
+    ///
+    SenderAwaiter(const SenderAwaiter &) = delete;
+
+    /// @brief Non-copyable and non-movable: the receiver points to it.
+    ///
+    SenderAwaiter &operator=(const SenderAwaiter &) = delete;
+
+    /// @brief Compiler contract: Nothing happens until the operation is
+    /// started, so always suspend.
+    ///
+    bool await_ready() noexcept
+    {
+        return false;
+    }
+
+    /// @brief Compiler contract: Suspend actions - start the operation. The
+    /// sender may complete inline, in which case the coroutine is resumed
+    /// right from `start`.
+    ///
+    template <Concepts::TaskImpl T, typename R>
+    void await_suspend(std::coroutine_handle<PromiseType<T, R>> h)
+    {
+        Base::await_suspend(h);
+
+        m_awaiting = h;
+        m_operation.start();
+    }
+
+    /// @brief Compiler contract: Resume action - take the sender's result.
+    /// @throws Sender's error, or OperationStopped.
+    ///
+    ValueT await_resume()
+    {
+        Base::await_resume();
+
+        if (auto *error = std::get_if<std::exception_ptr>(&m_result))
+        {
+            std::rethrow_exception(std::move(*error));
+        }
+
+        if constexpr (!std::is_void_v<ValueT>)
+        {
+            return std::move(std::get<StoredT>(m_result));
+        }
+    }
+
+private:
+    using StoredT =
+        std::conditional_t<std::is_void_v<ValueT>, VoidValue, ValueT>;
+
+    /// @brief Receiver which stores the result and resumes the coroutine.
+    ///
+    struct AwaitingReceiver
+    {
+        template <typename... Args>
+        void set_value(Args &&...args) noexcept
+        {
+            Self->m_result.template emplace<StoredT>(
+                std::forward<Args>(args)...);
+            Self->m_awaiting.resume();
+        }
+
+        template <typename E>
+        void set_error(E &&e) noexcept
+        {
+            if constexpr (std::is_same_v<std::remove_cvref_t<E>,
+                                         std::exception_ptr>)
+            {
+                Self->m_result.template emplace<std::exception_ptr>(
+                    std::forward<E>(e));
+            }
+            else
+            {
+                Self->m_result.template emplace<std::exception_ptr>(
+                    std::make_exception_ptr(std::forward<E>(e)));
+            }
+            Self->m_awaiting.resume();
+        }
+
+        void set_stopped() noexcept
+        {
+            Self->m_result.template emplace<std::exception_ptr>(
+                std::make_exception_ptr(OperationStopped{}));
+            Self->m_awaiting.resume();
+        }
+
+        SenderAwaiter *Self;
+    };
+
+    using OperationT = decltype(std::declval<S>().connect(
+        std::declval<AwaitingReceiver>()));
+
+    std::coroutine_handle<> m_awaiting{nullptr};
+    std::variant<std::monostate, StoredT, std::exception_ptr> m_result;
+    OperationT m_operation;
+};
+
+} // namespace Cortado::Detail
+
+#endif // CORTADO_DETAIL_SENDER_AWAITER_H
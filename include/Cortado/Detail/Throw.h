@@ -0,0 +1,39 @@
+/// @file Throw.h
+/// Throwing helper which also compiles with exceptions disabled.
+///
+
+#ifndef CORTADO_DETAIL_THROW_H
+#define CORTADO_DETAIL_THROW_H
+
+// STL
+//
+#include <exception>
+#include <utility>
+
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#define CORTADO_HAS_EXCEPTIONS 1
+#else
+#define CORTADO_HAS_EXCEPTIONS 0
+#endif
+
+namespace Cortado::Detail
+{
+
+/// @brief Throw an exception. In builds without exceptions
+/// (`-fno-exceptions`, `/EHs-c-`) there is nobody to catch it, so the
+/// process is terminated instead.
+/// @param e Exception to throw.
+///
+template <typename E>
+[[noreturn]] void Throw([[maybe_unused]] E &&e)
+{
+#if CORTADO_HAS_EXCEPTIONS
+    throw std::forward<E>(e);
+#else
+    std::terminate();
+#endif
+}
+
+} // namespace Cortado::Detail
+
+#endif // CORTADO_DETAIL_THROW_H
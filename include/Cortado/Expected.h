@@ -0,0 +1,335 @@
+/// @file Expected.h
+/// Value-or-error result which reports failures without exceptions.
+///
+
+#ifndef CORTADO_EXPECTED_H
+#define CORTADO_EXPECTED_H
+
+// STL
+//
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace Cortado
+{
+
+/// @brief Error wrapper which selects the error alternative of `Expected`,
+/// so that `co_return Unexpected{e};` works in a `Task<Expected<T, E>>`.
+/// @tparam E Error type.
+///
+template <typename E>
+class Unexpected
+{
+public:
+    /// @brief Constructor.
+    /// @param error Error to carry.
+    ///
+    template <typename G = E>
+        requires std::is_constructible_v<E, G>
+    explicit Unexpected(G &&error) : m_error{std::forward<G>(error)}
+    {
+    }
+
+    /// @brief Get carried error.
+    ///
+    E &Error() & noexcept
+    {
+        return m_error;
+    }
+
+    /// @brief Get carried error.
+    ///
+    const E &Error() const & noexcept
+    {
+        return m_error;
+    }
+
+    /// @brief Get carried error.
+    ///
+    E &&Error() && noexcept
+    {
+        return std::move(m_error);
+    }
+
+private:
+    E m_error;
+};
+
+template <typename E>
+Unexpected(E) -> Unexpected<E>;
+
+/// @brief Holds either a value or an error. Error path involves no throw
+/// and no allocation, and nothing in this class throws, so it is usable in
+/// `-fno-exceptions` builds. Accessing the wrong alternative terminates.
+/// Returned from a coroutine it is stored in the frame like any other
+/// value, and `co_await` hands it to the awaiter as is.
+/// @tparam T Value type.
+/// @tparam E Error type.
+///
+template <typename T, typename E>
+class Expected
+{
+public:
+    using ValueType = T;
+    using ErrorType = E;
+
+    /// @brief Constructs a default value.
+    ///
+    Expected()
+        requires std::is_default_constructible_v<T>
+        : m_storage{std::in_place_index<0>}
+    {
+    }
+
+    /// @brief Constructs a value.
+    /// @tparam U Same as T or convertible to it.
+    ///
+    template <typename U = T>
+        requires(!std::is_same_v<std::remove_cvref_t<U>, Expected> &&
+                 std::is_constructible_v<T, U>)
+    Expected(U &&value) :
+        m_storage{std::in_place_index<0>, std::forward<U>(value)}
+    {
+    }
+
+    /// @brief Constructs an error.
+    /// @tparam G Same as E or convertible to it.
+    ///
+    template <typename G>
+        requires std::is_constructible_v<E, const G &>
+    Expected(const Unexpected<G> &error) :
+        m_storage{std::in_place_index<1>, error.Error()}
+    {
+    }
+
+    /// @brief Constructs an error.
+    /// @tparam G Same as E or convertible to it.
+    ///
+    template <typename G>
+        requires std::is_constructible_v<E, G>
+    Expected(Unexpected<G> &&error) :
+        m_storage{std::in_place_index<1>, std::move(error).Error()}
+    {
+    }
+
+    /// @brief Check if a value is held.
+    ///
+    bool HasValue() const noexcept
+    {
+        return m_storage.index() == 0;
+    }
+
+    /// @brief Check if a value is held.
+    ///
+    explicit operator bool() const noexcept
+    {
+        return HasValue();
+    }
+
+    /// @brief Get held value. Terminates if an error is held.
+    ///
+    T &Value() & noexcept
+    {
+        return *Alternative<0>(&m_storage);
+    }
+
+    /// @brief Get held value. Terminates if an error is held.
+    ///
+    const T &Value() const & noexcept
+    {
+        return *Alternative<0>(&m_storage);
+    }
+
+    /// @brief Get held value. Terminates if an error is held.
+    ///
+    T &&Value() && noexcept
+    {
+        return std::move(*Alternative<0>(&m_storage));
+    }
+
+    /// @brief Get held error. Terminates if a value is held.
+    ///
+    E &Error() & noexcept
+    {
+        return *Alternative<1>(&m_storage);
+    }
+
+    /// @brief Get held error. Terminates if a value is held.
+    ///
+    const E &Error() const & noexcept
+    {
+        return *Alternative<1>(&m_storage);
+    }
+
+    /// @brief Get held error. Terminates if a value is held.
+    ///
+    E &&Error() && noexcept
+    {
+        return std::move(*Alternative<1>(&m_storage));
+    }
+
+    /// @brief Get held value or a fallback.
+    /// @param fallback Value returned if an error is held.
+    ///
+    template <typename U>
+    T ValueOr(U &&fallback) const &
+    {
+        return HasValue() ? Value()
+                          : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    /// @brief Get held value. Terminates if an error is held.
+    ///
+    T &operator*() & noexcept
+    {
+        return Value();
+    }
+
+    /// @brief Get held value. Terminates if an error is held.
+    ///
+    const T &operator*() const & noexcept
+    {
+        return Value();
+    }
+
+    /// @brief Get held value. Terminates if an error is held.
+    ///
+    T &&operator*() && noexcept
+    {
+        return std::move(*this).Value();
+    }
+
+    /// @brief Access held value. Terminates if an error is held.
+    ///
+    T *operator->() noexcept
+    {
+        return &Value();
+    }
+
+    /// @brief Access held value. Terminates if an error is held.
+    ///
+    const T *operator->() const noexcept
+    {
+        return &Value();
+    }
+
+private:
+    /// @brief Checked access to an alternative without `bad_variant_access`.
+    ///
+    template <std::size_t I, typename V>
+    static auto *Alternative(V *storage) noexcept
+    {
+        auto *alternative = std::get_if<I>(storage);
+        if (alternative == nullptr)
+        {
+            std::terminate();
+        }
+
+        return alternative;
+    }
+
+    std::variant<T, E> m_storage;
+};
+
+/// @brief Specialization for operations that only report success or error.
+/// @tparam E Error type.
+///
+template <typename E>
+class Expected<void, E>
+{
+public:
+    using ValueType = void;
+    using ErrorType = E;
+
+    /// @brief Constructs success.
+    ///
+    Expected() = default;
+
+    /// @brief Constructs an error.
+    /// @tparam G Same as E or convertible to it.
+    ///
+    template <typename G>
+        requires std::is_constructible_v<E, const G &>
+    Expected(const Unexpected<G> &error) : m_error{error.Error()}
+    {
+    }
+
+    /// @brief Constructs an error.
+    /// @tparam G Same as E or convertible to it.
+    ///
+    template <typename G>
+        requires std::is_constructible_v<E, G>
+    Expected(Unexpected<G> &&error) : m_error{std::move(error).Error()}
+    {
+    }
+
+    /// @brief Check if operation succeeded.
+    ///
+    bool HasValue() const noexcept
+    {
+        return !m_error.has_value();
+    }
+
+    /// @brief Check if operation succeeded.
+    ///
+    explicit operator bool() const noexcept
+    {
+        return HasValue();
+    }
+
+    /// @brief Get held error. Terminates on success.
+    ///
+    E &Error() & noexcept
+    {
+        return *Checked();
+    }
+
+    /// @brief Get held error. Terminates on success.
+    ///
+    const E &Error() const & noexcept
+    {
+        return *Checked();
+    }
+
+    /// @brief Get held error. Terminates on success.
+    ///
+    E &&Error() && noexcept
+    {
+        return std::move(*Checked());
+    }
+
+private:
+    /// @brief Checked access to the error.
+    ///
+    E *Checked() noexcept
+    {
+        if (!m_error.has_value())
+        {
+            std::terminate();
+        }
+
+        return &*m_error;
+    }
+
+    /// @brief Checked access to the error.
+    ///
+    const E *Checked() const noexcept
+    {
+        if (!m_error.has_value())
+        {
+            std::terminate();
+        }
+
+        return &*m_error;
+    }
+
+    std::optional<E> m_error;
+};
+
+} // namespace Cortado
+
+#endif // CORTADO_EXPECTED_H
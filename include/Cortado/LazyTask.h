@@ -0,0 +1,36 @@
+/// @file LazyTask.h
+/// Task that starts on first await.
+///
+
+#ifndef CORTADO_LAZY_TASK_H
+#define CORTADO_LAZY_TASK_H
+
+// Cortado
+//
+#include <Cortado/Task.h>
+
+namespace Cortado
+{
+
+/// @brief TaskImpl adapter which makes coroutines start only when they are
+/// awaited, waited for or explicitly started. The awaiting coroutine then
+/// installs its continuation before the child runs, and transfers to the
+/// child without a compare-exchange.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+///
+template <Concepts::TaskImpl T>
+struct LazyTaskImpl : T
+{
+    static constexpr bool StartOnAwait = true;
+};
+
+/// @brief Task that does not run until it is awaited.
+/// @tparam R Return type of coroutine.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+///
+template <typename R = void, Concepts::TaskImpl T = DefaultTaskImpl>
+using LazyTask = Task<R, LazyTaskImpl<T>>;
+
+} // namespace Cortado
+
+#endif // CORTADO_LAZY_TASK_H
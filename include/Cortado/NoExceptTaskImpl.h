@@ -0,0 +1,35 @@
+/// @file NoExceptTaskImpl.h
+/// Task implementation for coroutines that never fail.
+///
+
+#ifndef CORTADO_NO_EXCEPT_TASK_IMPL_H
+#define CORTADO_NO_EXCEPT_TASK_IMPL_H
+
+// Cortado
+//
+#include <Cortado/Common/NoExceptHandler.h>
+#include <Cortado/Common/STLAtomic.h>
+#include <Cortado/Common/STLCoroutineAllocator.h>
+#include <Cortado/DefaultEvent.h>
+#include <Cortado/DefaultScheduler.h>
+
+namespace Cortado
+{
+
+/// @brief Default implementation for code built without exceptions, or for
+/// coroutines that report failures through their result (see `Expected`).
+/// Frames have no error storage and `Get` has no rethrow branch; an
+/// exception escaping a coroutine terminates the process.
+///
+struct NoExceptTaskImpl :
+    Common::STLAtomic,
+    Common::STLCoroutineAllocator,
+    Common::NoExceptHandler,
+    DefaultScheduler
+{
+    using Event = Cortado::DefaultEvent;
+};
+
+} // namespace Cortado
+
+#endif // CORTADO_NO_EXCEPT_TASK_IMPL_H
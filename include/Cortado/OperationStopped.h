@@ -0,0 +1,28 @@
+/// @file OperationStopped.h
+/// Exception which reports a stopped or cancelled operation.
+///
+
+#ifndef CORTADO_OPERATION_STOPPED_H
+#define CORTADO_OPERATION_STOPPED_H
+
+// STL
+//
+#include <exception>
+
+namespace Cortado
+{
+
+/// @brief Exception thrown from `co_await` if the awaited operation was
+/// cancelled, or if an awaited sender completed with `set_stopped`.
+///
+struct OperationStopped : std::exception
+{
+    const char *what() const noexcept override
+    {
+        return "Cortado: operation stopped";
+    }
+};
+
+} // namespace Cortado
+
+#endif // CORTADO_OPERATION_STOPPED_H
@@ -0,0 +1,101 @@
+/// @file SchedulerRef.h
+/// Type-erased non-owning reference to a coroutine scheduler.
+///
+
+#ifndef CORTADO_SCHEDULER_REF_H
+#define CORTADO_SCHEDULER_REF_H
+
+// Cortado
+//
+#include <Cortado/Concepts/CoroutineScheduler.h>
+
+// STL
+//
+#include <type_traits>
+
+namespace Cortado
+{
+
+/// @brief Non-owning reference to any @link
+/// Cortado::Concepts::CoroutineScheduler CoroutineScheduler@endlink.
+/// It is two pointers wide and itself satisfies the concept, so that
+/// schedulers of different types can be stored and compared uniformly.
+///
+class SchedulerRef
+{
+public:
+    /// @brief Type-erased scheduling function.
+    ///
+    using ScheduleFuncT = void (*)(std::coroutine_handle<>, void *);
+
+    /// @brief Constructs an empty reference.
+    ///
+    SchedulerRef() = default;
+
+    /// @brief Constructs a reference to a scheduler.
+    /// @tparam SchedulerT Type of referenced scheduler.
+    /// @param sched Referenced scheduler. Must outlive the reference.
+    ///
+    template <Concepts::CoroutineScheduler SchedulerT>
+        requires(!std::is_same_v<SchedulerT, SchedulerRef>)
+    SchedulerRef(SchedulerT &sched) noexcept :
+        m_scheduleFunc{ScheduleOn<SchedulerT>},
+        m_context{&sched}
+    {
+    }
+
+    /// @brief Concept contract: Schedules coroutine on the referenced
+    /// scheduler.
+    /// @param h Coroutine to schedule.
+    ///
+    void Schedule(std::coroutine_handle<> h) const
+    {
+        m_scheduleFunc(h, m_context);
+    }
+
+    /// @brief Check if reference is not empty.
+    ///
+    explicit operator bool() const noexcept
+    {
+        return m_context != nullptr;
+    }
+
+    /// @brief Type-erased scheduling function.
+    ///
+    ScheduleFuncT GetScheduleFunc() const noexcept
+    {
+        return m_scheduleFunc;
+    }
+
+    /// @brief Address of the referenced scheduler.
+    ///
+    void *GetContext() const noexcept
+    {
+        return m_context;
+    }
+
+    /// @brief References are equal if they point to the same scheduler.
+    ///
+    friend bool operator==(const SchedulerRef &lhs,
+                           const SchedulerRef &rhs) noexcept
+    {
+        return lhs.m_context == rhs.m_context;
+    }
+
+private:
+    /// @brief Restores scheduler type and schedules coroutine on it.
+    /// @tparam SchedulerT Type of referenced scheduler.
+    ///
+    template <typename SchedulerT>
+    static void ScheduleOn(std::coroutine_handle<> h, void *context)
+    {
+        static_cast<SchedulerT *>(context)->Schedule(h);
+    }
+
+    ScheduleFuncT m_scheduleFunc{nullptr};
+    void *m_context{nullptr};
+};
+
+} // namespace Cortado
+
+#endif // CORTADO_SCHEDULER_REF_H
@@ -0,0 +1,224 @@
+/// @file SchedulerRegistry.h
+/// Runtime registry of named scheduler pools.
+///
+
+#ifndef CORTADO_SCHEDULER_REGISTRY_H
+#define CORTADO_SCHEDULER_REGISTRY_H
+
+// Cortado
+//
+#include <Cortado/AwaiterBase.h>
+#include <Cortado/Detail/CancellableAwaiter.h>
+#include <Cortado/Detail/Throw.h>
+#include <Cortado/SchedulerRef.h>
+
+// STL
+//
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace Cortado
+{
+
+/// @brief Registry of named scheduler pools, e.g. "io", "cpu" and "latency".
+/// Each pool is an independent scheduler with its own sizing, so a slow
+/// workload can be kept away from a latency-critical one while coroutines of
+/// any TaskImpl move freely between pools.
+///
+class SchedulerRegistry
+{
+public:
+    /// @brief Default constructor.
+    ///
+    SchedulerRegistry() = default;
+
+    /// @brief Non-copyable.
+    ///
+    SchedulerRegistry(const SchedulerRegistry &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    SchedulerRegistry &operator=(const SchedulerRegistry &) = delete;
+
+    /// @brief Create a pool owned by the registry.
+    /// @tparam SchedulerT Pool type.
+    /// @tparam Args Pool constructor arguments.
+    /// @param name Pool name.
+    /// @param args Pool constructor arguments, e.g. number of threads.
+    /// @returns Reference to the created pool.
+    /// @throws std::invalid_argument if the name is already taken.
+    ///
+    template <Concepts::CoroutineScheduler SchedulerT, typename... Args>
+    SchedulerT &Emplace(std::string name, Args &&...args)
+    {
+        auto pool = std::make_unique<SchedulerT>(std::forward<Args>(args)...);
+        SchedulerT &ref = *pool;
+
+        Insert(std::move(name),
+               Entry{SchedulerRef{ref},
+                     OwnedPtr{pool.release(), DeletePool<SchedulerT>}});
+
+        return ref;
+    }
+
+    /// @brief Register a pool owned by the caller.
+    /// @tparam SchedulerT Pool type.
+    /// @param name Pool name.
+    /// @param sched Pool. Must outlive the registry.
+    /// @throws std::invalid_argument if the name is already taken.
+    ///
+    template <Concepts::CoroutineScheduler SchedulerT>
+    void Register(std::string name, SchedulerT &sched)
+    {
+        Insert(std::move(name),
+               Entry{SchedulerRef{sched}, OwnedPtr{nullptr, nullptr}});
+    }
+
+    /// @brief Look up a pool.
+    /// @param name Pool name.
+    /// @returns Reference to the pool, empty if not registered.
+    ///
+    SchedulerRef Find(std::string_view name) const
+    {
+        std::shared_lock lk{m_mutex};
+
+        auto it = m_pools.find(name);
+        return it != m_pools.end() ? it->second.Ref : SchedulerRef{};
+    }
+
+    /// @brief Look up a pool.
+    /// @param name Pool name.
+    /// @returns Reference to the pool.
+    /// @throws std::out_of_range if the pool is not registered.
+    ///
+    SchedulerRef Get(std::string_view name) const
+    {
+        SchedulerRef ref = Find(name);
+        if (!ref)
+        {
+            Detail::Throw(
+                std::out_of_range{"Cortado: unknown scheduler pool"});
+        }
+
+        return ref;
+    }
+
+    /// @brief Get app-global registry instance.
+    ///
+    static SchedulerRegistry &Global()
+    {
+        static SchedulerRegistry registry;
+        return registry;
+    }
+
+private:
+    using OwnedPtr = std::unique_ptr<void, void (*)(void *)>;
+
+    struct Entry
+    {
+        SchedulerRef Ref;
+        OwnedPtr Owned;
+    };
+
+    template <typename SchedulerT>
+    static void DeletePool(void *pool)
+    {
+        delete static_cast<SchedulerT *>(pool);
+    }
+
+    void Insert(std::string name, Entry entry)
+    {
+        std::unique_lock lk{m_mutex};
+
+        if (!m_pools.emplace(std::move(name), std::move(entry)).second)
+        {
+            Detail::Throw(std::invalid_argument{
+                "Cortado: scheduler pool is already registered"});
+        }
+    }
+
+    mutable std::shared_mutex m_mutex;
+    std::map<std::string, Entry, std::less<>> m_pools;
+};
+
+/// @brief Awaiter that transfers coroutine execution to a referenced pool.
+///
+struct SchedulerRefAwaiter : AwaiterBase
+{
+    /// @brief Constructor.
+    /// @param pool The target pool.
+    ///
+    SchedulerRefAwaiter(SchedulerRef pool) noexcept : m_pool{pool}
+    {
+    }
+
+    /// @brief Compiler contract: We indicate that a task is not ready to
+    /// always transfer task to the pool.
+    ///
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    /// @brief Compiler contract: Suspend actions - suspend and move to the
+    /// pool.
+    ///
+    template <Concepts::TaskImpl T, typename R>
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T, R>> h)
+    {
+        if (!m_cancellation.Capture(h))
+        {
+            return false;
+        }
+
+        Base::await_suspend(h);
+
+        [[maybe_unused]] auto handOff = h.promise().HandOver();
+        m_pool.Schedule(h);
+        return true;
+    }
+
+    /// @brief Compiler contract: Resume action - restore AwaiterBase state.
+    /// @throws OperationStopped if the awaiting coroutine was cancelled.
+    ///
+    void await_resume()
+    {
+        Base::await_resume();
+        m_cancellation.ThrowIfCancelled();
+    }
+
+private:
+    SchedulerRef m_pool;
+    Detail::CancellationCheck m_cancellation;
+};
+
+/// @brief co_await shortcut for resuming on a named pool.
+/// @param name Pool name.
+/// @param registry Registry to look the pool up in.
+/// @returns SchedulerRefAwaiter.
+/// @throws std::out_of_range if the pool is not registered.
+///
+inline SchedulerRefAwaiter OnPool(
+    std::string_view name,
+    const SchedulerRegistry &registry = SchedulerRegistry::Global())
+{
+    return SchedulerRefAwaiter{registry.Get(name)};
+}
+
+/// @brief co_await shortcut for resuming on a previously looked up pool.
+/// Avoids a registry lookup on hot paths.
+/// @param pool Pool reference.
+/// @returns SchedulerRefAwaiter.
+///
+inline SchedulerRefAwaiter OnPool(SchedulerRef pool)
+{
+    return SchedulerRefAwaiter{pool};
+}
+
+} // namespace Cortado
+
+#endif // CORTADO_SCHEDULER_REGISTRY_H
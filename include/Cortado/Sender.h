@@ -0,0 +1,315 @@
+/// @file Sender.h
+/// Interoperability between Cortado and sender/receiver style code.
+///
+
+#ifndef CORTADO_SENDER_H
+#define CORTADO_SENDER_H
+
+// Cortado
+//
+#include <Cortado/Task.h>
+#include <Cortado/Concepts/CoroutineScheduler.h>
+#include <Cortado/Concepts/Sender.h>
+#include <Cortado/Detail/CoroutineAwaiterQueueNode.h>
+
+// STL
+//
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace Cortado
+{
+namespace Detail
+{
+
+/// @brief Minimal detached coroutine used to get a coroutine handle for
+/// schedulers that cannot run plain callables.
+///
+struct ScheduleTrampoline
+{
+    struct promise_type
+    {
+        ScheduleTrampoline get_return_object() noexcept
+        {
+            return {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    std::coroutine_handle<promise_type> Handle;
+};
+
+/// @brief Operation state of the `Schedule` sender.
+/// @tparam SchedulerT Scheduler type.
+/// @tparam ReceiverT Receiver type.
+///
+template <Concepts::CoroutineScheduler SchedulerT, typename ReceiverT>
+class ScheduleOperation
+{
+public:
+    /// @brief Constructor.
+    /// @param sched Scheduler to complete on.
+    /// @param receiver Receiver to complete.
+    ///
+    ScheduleOperation(SchedulerT &sched, ReceiverT &&receiver) :
+        m_scheduler{sched},
+        m_receiver{std::move(receiver)}
+    {
+    }
+
+    /// @brief Non-copyable and non-movable.
+    ///
+    ScheduleOperation(const ScheduleOperation &) = delete;
+
+    /// @brief Non-copyable and non-movable.
+    ///
+    ScheduleOperation &operator=(const ScheduleOperation &) = delete;
+
+    /// @brief Sender contract: Complete the receiver on the scheduler.
+    /// Posting schedulers run it as a plain callable that fits the job's
+    /// inline storage; others need a small coroutine frame.
+    ///
+    void start() noexcept
+    {
+        if constexpr (Concepts::PostingScheduler<SchedulerT>)
+        {
+            m_scheduler.Post([this] { std::move(m_receiver).set_value(); });
+        }
+        else
+        {
+            m_scheduler.Schedule(Complete(this).Handle);
+        }
+    }
+
+private:
+    static ScheduleTrampoline Complete(ScheduleOperation *self)
+    {
+        std::move(self->m_receiver).set_value();
+        co_return;
+    }
+
+    SchedulerT &m_scheduler;
+    ReceiverT m_receiver;
+};
+
+/// @brief Sender that completes on a scheduler's thread.
+/// @tparam SchedulerT Scheduler type.
+///
+template <Concepts::CoroutineScheduler SchedulerT>
+struct ScheduleSender
+{
+    /// @brief Sender contract: completes without a value.
+    ///
+    using value_type = void;
+
+    /// @brief Sender contract: Connect to a receiver.
+    /// @param receiver Receiver to complete.
+    /// @returns Operation state.
+    ///
+    template <Concepts::Receiver<void> ReceiverT>
+    ScheduleOperation<SchedulerT, std::remove_cvref_t<ReceiverT>> connect(
+        ReceiverT &&receiver) const
+    {
+        return {Scheduler, std::forward<ReceiverT>(receiver)};
+    }
+
+    SchedulerT &Scheduler;
+};
+
+/// @brief Sender that completes with a task's result.
+/// @tparam R Task return value type.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+///
+template <typename R, Concepts::TaskImpl T>
+struct TaskSender
+{
+    /// @brief Sender contract: completes with the task's value.
+    ///
+    using value_type = R;
+
+    /// @brief Sender contract: Connect to a receiver.
+    /// @param receiver Receiver to complete.
+    /// @returns Operation state.
+    ///
+    template <Concepts::Receiver<R> ReceiverT>
+    typename Task<R, T>::template SenderOperation<
+        std::remove_cvref_t<ReceiverT>>
+    connect(ReceiverT &&receiver) &&
+    {
+        return {std::move(Source), std::forward<ReceiverT>(receiver)};
+    }
+
+    Task<R, T> Source;
+};
+
+} // namespace Detail
+
+/// @brief Task operation state. The operation is the continuation node of
+/// the task, so the receiver is completed right from the task's final
+/// suspension, without an intermediate coroutine frame.
+/// @tparam R Task return value type.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+/// @tparam ReceiverT Receiver type.
+///
+template <typename R, Concepts::TaskImpl T>
+template <typename ReceiverT>
+class Task<R, T>::SenderOperation : Detail::CoroutineAwaiterQueueNode
+{
+public:
+    /// @brief Constructor.
+    /// @param task Task to observe.
+    /// @param receiver Receiver to complete.
+    ///
+    SenderOperation(Task<R, T> &&task, ReceiverT &&receiver) :
+        m_task{std::move(task)},
+        m_receiver{std::move(receiver)}
+    {
+    }
+
+    /// @brief Non-copyable and non-movable: the task points to it.
+    ///
+    SenderOperation(const SenderOperation &) = delete;
+
+    /// @brief Non-copyable and non-movable: the task points to it.
+    ///
+    SenderOperation &operator=(const SenderOperation &) = delete;
+
+    /// @brief Sender contract: Subscribe to task completion. Completes the
+    /// receiver inline if the task has already completed, starts it if it is
+    /// lazy.
+    ///
+    void start() noexcept
+    {
+        // There is no coroutine to resume, only a receiver to complete.
+        //
+        this->HandleToResume = std::noop_coroutine();
+        this->HandleResumerFunc = OnCompleted;
+        this->HandleResumerFuncContext = this;
+
+        auto &promise = m_task.m_handle.promise();
+
+        if constexpr (promise_type::IsLazy)
+        {
+            if (promise.TryStart())
+            {
+                promise.SetContinuationBeforeStart(this);
+                m_task.m_handle.resume();
+                return;
+            }
+        }
+
+        if (!promise.SetContinuation(this))
+        {
+            Complete();
+        }
+    }
+
+private:
+    /// @brief Continuation node contract: called by the completed task.
+    ///
+    static std::coroutine_handle<> OnCompleted(std::coroutine_handle<>,
+                                               void *context)
+    {
+        static_cast<SenderOperation *>(context)->Complete();
+        return std::noop_coroutine();
+    }
+
+    /// @brief Pass the task's result to the receiver.
+    ///
+    void Complete() noexcept
+    {
+        auto &promise = m_task.m_handle.promise();
+
+        if constexpr (!promise_type::IsNoExcept)
+        {
+            if (promise.HasError())
+            {
+                SetError(promise.TakeError());
+                return;
+            }
+        }
+
+        if constexpr (std::is_void_v<R>)
+        {
+            std::move(m_receiver).set_value();
+        }
+        else
+        {
+            std::move(m_receiver).set_value(promise.Get());
+        }
+    }
+
+    /// @brief Pass the task's error to the receiver. Receivers only have to
+    /// accept `std::exception_ptr`, so errors of a custom @link
+    /// Cortado::Concepts::ErrorHandler ErrorHandler@endlink the receiver
+    /// does not take as is are wrapped into one.
+    /// @param e Stored error.
+    ///
+    void SetError(typename T::Exception &&e) noexcept
+    {
+        constexpr bool TakesError = requires {
+            std::move(m_receiver).set_error(std::move(e));
+        };
+
+        if constexpr (TakesError)
+        {
+            std::move(m_receiver).set_error(std::move(e));
+        }
+        else
+        {
+            std::move(m_receiver).set_error(
+                std::make_exception_ptr(std::move(e)));
+        }
+    }
+
+    Task<R, T> m_task;
+    ReceiverT m_receiver;
+};
+
+/// @brief Sender that completes on the scheduler's thread. `co_await` it
+/// from a Task, or connect it to any receiver.
+/// @tparam SchedulerT Scheduler type.
+/// @param sched Scheduler to complete on.
+/// @returns Sender.
+///
+template <Concepts::CoroutineScheduler SchedulerT>
+inline Detail::ScheduleSender<SchedulerT> Schedule(SchedulerT &sched)
+{
+    return {sched};
+}
+
+/// @brief Turn a task into a sender that completes with its result.
+/// @tparam R Task return value type.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+/// @param task Task to observe.
+/// @returns Sender.
+///
+template <typename R, Concepts::TaskImpl T>
+inline Detail::TaskSender<R, T> AsSender(Task<R, T> &&task)
+{
+    return {std::move(task)};
+}
+
+} // namespace Cortado
+
+#endif // CORTADO_SENDER_H
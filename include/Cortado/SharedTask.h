@@ -0,0 +1,226 @@
+/// @file SharedTask.h
+/// Task whose result can be awaited by many coroutines.
+///
+
+#ifndef CORTADO_SHARED_TASK_H
+#define CORTADO_SHARED_TASK_H
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Task.h>
+
+// STL
+//
+#include <utility>
+
+namespace Cortado
+{
+
+/// @brief TaskImpl adapter which lets any number of coroutines await the
+/// same coroutine. Awaiters form an intrusive lock-free stack in the
+/// promise, so awaiting allocates nothing, and the result is handed out by
+/// const reference.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+///
+template <Concepts::TaskImpl T>
+struct SharedTaskImpl : T
+{
+    static_assert(!Concepts::LazyStart<T>,
+                  "Lazy tasks are started by a single awaiter");
+
+    static constexpr bool ShareResult = true;
+};
+
+/// @brief Copyable task. Every copy refers to the same coroutine, which is
+/// destroyed when the last copy is gone and the coroutine has completed.
+/// @tparam R Return type of coroutine.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+///
+template <typename R = void, Concepts::TaskImpl T = DefaultTaskImpl>
+class SharedTask
+{
+public:
+    struct Awaiter;
+
+    using ImplT = SharedTaskImpl<T>;
+    using promise_type = Detail::PromiseType<ImplT, R>;
+
+    /// @brief Constructor. Takes over the coroutine from the return object.
+    /// @param task Task returned by the promise.
+    ///
+    SharedTask(Task<R, ImplT> &&task) noexcept :
+        m_handle{std::exchange(task.m_handle, nullptr)}
+    {
+    }
+
+    /// @brief Copy constructor. Shares the coroutine.
+    ///
+    SharedTask(const SharedTask &other) noexcept : m_handle{other.m_handle}
+    {
+        if (m_handle)
+        {
+            m_handle.promise().AddOwner();
+        }
+    }
+
+    /// @brief Copy assignment. Shares the coroutine.
+    ///
+    SharedTask &operator=(const SharedTask &other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_handle = other.m_handle;
+
+            if (m_handle)
+            {
+                m_handle.promise().AddOwner();
+            }
+        }
+
+        return *this;
+    }
+
+    /// @brief Move constructor.
+    ///
+    SharedTask(SharedTask &&other) noexcept :
+        m_handle{std::exchange(other.m_handle, nullptr)}
+    {
+    }
+
+    /// @brief Move assignment.
+    ///
+    SharedTask &operator=(SharedTask &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    /// @brief Destructor. Releases this copy's hold on the coroutine.
+    ///
+    ~SharedTask()
+    {
+        Reset();
+    }
+
+    /// @brief Test if task is completed.
+    /// @returns true is task is completed, false otherwise.
+    ///
+    inline bool IsReady() const
+    {
+        return m_handle.promise().Ready();
+    }
+
+    /// @brief Wait task completion for indefinite amout of time.
+    ///
+    inline void Wait() const
+        requires Concepts::HasEvent<T>
+    {
+        m_handle.promise().Wait();
+    }
+
+    /// @brief Wait for task completion in a period of time.
+    /// @param timeToWaitMs How many milliseconds to wait.
+    /// @returns true if event was set in timeToWaitMs, false otherwise.
+    ///
+    inline bool WaitFor(unsigned long timeToWaitMs) const
+        requires Concepts::HasEvent<T>
+    {
+        return m_handle.promise().WaitFor(timeToWaitMs);
+    }
+
+    /// @brief Get task result.
+    /// @returns Const reference to task result, valid while this task is.
+    /// @throws Copy of the exception if present.
+    ///
+    decltype(auto) Get() const
+        requires Concepts::HasEvent<T>
+    {
+        m_handle.promise().Wait();
+
+        return m_handle.promise().Get();
+    }
+
+private:
+    std::coroutine_handle<promise_type> m_handle{nullptr};
+
+    /// @brief Lifetime helper. The last copy destroys a completed
+    /// coroutine, otherwise the coroutine destroys itself on completion.
+    ///
+    void Reset() noexcept
+    {
+        if (m_handle && m_handle.promise().Detach())
+        {
+            m_handle.destroy();
+        }
+
+        m_handle = nullptr;
+    }
+};
+
+/// @brief Shared task awaiter. The awaiter itself is the node in the list of
+/// coroutines awaiting the task.
+/// @tparam R Return value type of awaited coroutine.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+///
+template <typename R, Concepts::TaskImpl T>
+struct SharedTask<R, T>::Awaiter : Detail::TaskContinuationAwaiter
+{
+    /// @brief Constructor.
+    /// @param task The task to await. Must outlive the `co_await`.
+    ///
+    Awaiter(const SharedTask<R, T> &task) : m_awaitedTask{task}
+    {
+    }
+
+    /// @brief Compiler contract: If task is ready, we can immediately resume.
+    ///
+    bool await_ready()
+    {
+        return m_awaitedTask.m_handle.promise().Ready();
+    }
+
+    /// @brief Compiler contract: Join the list of awaiters if co_await target
+    /// is not ready.
+    ///
+    template <Concepts::TaskImpl T2, typename R2>
+    bool await_suspend(std::coroutine_handle<Detail::PromiseType<T2, R2>> h)
+    {
+        return SuspendOn(h, m_awaitedTask.m_handle.promise());
+    }
+
+    /// @brief Compiler contract: Resume action - take const reference to
+    /// co_await's target result.
+    ///
+    decltype(auto) await_resume()
+    {
+        Base::await_resume();
+
+        return m_awaitedTask.m_handle.promise().Get();
+    }
+
+private:
+    const SharedTask<R, T> &m_awaitedTask;
+};
+
+/// @brief Compiler contract: co_await operator implementation when a task
+/// awaits for a shared task.
+/// @tparam R Return value type of awaited coroutine.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+/// @returns SharedTask awaiter.
+///
+template <typename R, Concepts::TaskImpl T>
+inline auto operator co_await(const SharedTask<R, T> &task)
+{
+    return typename SharedTask<R, T>::Awaiter{task};
+}
+
+} // namespace Cortado
+
+#endif // CORTADO_SHARED_TASK_H
@@ -0,0 +1,35 @@
+/// @file SingleThreadedTaskImpl.h
+/// Task implementation for coroutines that never cross threads.
+///
+
+#ifndef CORTADO_SINGLE_THREADED_TASK_IMPL_H
+#define CORTADO_SINGLE_THREADED_TASK_IMPL_H
+
+// Cortado
+//
+#include <Cortado/Common/NonAtomic.h>
+#include <Cortado/Common/SingleThreadedEvent.h>
+#include <Cortado/Common/STLCoroutineAllocator.h>
+#include <Cortado/Common/STLExceptionHandler.h>
+
+namespace Cortado
+{
+
+/// @brief Implementation for coroutines that are created, resumed and
+/// completed on one thread, e.g. a per-connection pipeline driven by an
+/// event loop. Promise state, reference counts and the completion event are
+/// plain integers, so a co_await costs about as much as a callback. There is
+/// no background scheduler on purpose: such a task must not be resumed on
+/// another thread.
+///
+struct SingleThreadedTaskImpl :
+    Common::NonAtomicPrimitive,
+    Common::STLCoroutineAllocator,
+    Common::STLExceptionHandler
+{
+    using Event = Common::SingleThreadedEvent;
+};
+
+} // namespace Cortado
+
+#endif // CORTADO_SINGLE_THREADED_TASK_IMPL_H
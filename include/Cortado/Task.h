@@ -8,15 +8,23 @@
 // Cortado
 //
 #include <Cortado/DefaultTaskImpl.h>
+#include <Cortado/Detail/CompletionCallbackNode.h>
 #include <Cortado/Detail/PromiseType.h>
 
 // STL
 //
+#include <type_traits>
 #include <utility>
 
 namespace Cortado
 {
 
+template <typename R, Concepts::TaskImpl T, typename F>
+class MappedTask;
+
+template <Concepts::Atomic AtomicT>
+class AsyncScope;
+
 /// @brief Task implementation type.
 /// @tparam R Return type of coroutine.
 /// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
@@ -28,6 +36,9 @@ public:
     struct TaskAwaiter;
     struct TaskLValueAwaier;
 
+    template <typename ReceiverT>
+    class SenderOperation;
+
     using promise_type = Detail::PromiseType<T, R>;
 
     /// @brief Constructor.
@@ -63,8 +74,8 @@ public:
     ///
     Task &operator=(const Task &) = delete;
 
-    /// @brief Destructor. Decrements reference count on the promise
-    /// and destroys it if needed.
+    /// @brief Destructor. Detaches from the promise and destroys it if
+    /// needed.
     ///
     ~Task()
     {
@@ -82,7 +93,9 @@ public:
     /// @brief Wait task completion for indefinite amout of time.
     ///
     inline void Wait()
+        requires Concepts::HasEvent<T>
     {
+        Start();
         m_handle.promise().Wait();
     }
 
@@ -91,7 +104,9 @@ public:
     /// @returns true if event was set in timeToWaitMs, false otherwise.
     ///
     inline bool WaitFor(unsigned long timeToWaitMs)
+        requires Concepts::HasEvent<T>
     {
+        Start();
         return m_handle.promise().WaitFor(timeToWaitMs);
     }
 
@@ -100,21 +115,100 @@ public:
     /// @throws Exception if present.
     ///
     decltype(auto) Get()
+        requires Concepts::HasEvent<T>
     {
+        Start();
         m_handle.promise().Wait();
 
         return m_handle.promise().Get();
     }
 
+    /// @brief Start a lazy task on the calling thread, if it is not started
+    /// yet. Runs the coroutine up to its first suspension point. Eager tasks
+    /// are always started.
+    ///
+    inline void Start()
+    {
+        if constexpr (promise_type::IsLazy)
+        {
+            if (m_handle.promise().TryStart())
+            {
+                m_handle.resume();
+            }
+        }
+    }
+
+    /// @brief Attach post-processing of the result. No wrapper coroutine is
+    /// created: `fn` runs when the returned object is awaited or its result
+    /// is taken. Defined in Await.h.
+    /// @param fn Callable taking the result (nothing for void tasks).
+    /// @returns Awaitable which yields `fn`'s result.
+    ///
+    template <typename F>
+    MappedTask<R, T, std::decay_t<F>> Then(F &&fn) &&;
+
+    /// @brief Run a callable right when the coroutine completes and let go
+    /// of the task. The callable takes the continuation slot of the promise,
+    /// so it runs from final suspension on the completing thread, or right
+    /// here if the coroutine has already completed. Only a small node for
+    /// the callable is allocated.
+    /// @param fn Callable without arguments. Must not throw.
+    ///
+    template <typename F>
+    void OnComplete(F &&fn) &&
+    {
+        using NodeT = Detail::CompletionCallbackNode<std::decay_t<F>>;
+
+        DetachWithContinuation(
+            NodeT::Create(std::forward<F>(fn), m_handle));
+    }
+
 private:
+    template <typename R2, Concepts::TaskImpl T2>
+    friend class SharedTask;
+
+    template <Concepts::Atomic AtomicT>
+    friend class AsyncScope;
+
+    /// @brief Start the coroutine, hand its continuation slot to a node and
+    /// let go of the task. The node runs once the frame is freed, right here
+    /// if the coroutine has already completed.
+    /// @param node Node to run on completion.
+    ///
+    void DetachWithContinuation(Detail::CoroutineAwaiterQueueNode *node)
+    {
+        Start();
+
+        if constexpr (promise_type::IsShared)
+        {
+            if (!m_handle.promise().SetContinuation(node))
+            {
+                node->Resume();
+            }
+
+            Reset();
+            m_handle = nullptr;
+        }
+        else
+        {
+            auto handle = std::exchange(m_handle, nullptr);
+            if (!handle.promise().DetachWithContinuation(node))
+            {
+                handle.destroy();
+                node->Resume();
+            }
+        }
+    }
+
     std::coroutine_handle<promise_type> m_handle {nullptr};
 
-    /// @brief Lifetime helper. If promise reference count reaches zero,
-    /// the promise is destroyed.
+    /// @brief Lifetime helper. If coroutine has already completed, the
+    /// promise is destroyed, otherwise the coroutine destroys it on
+    /// completion.
     ///
     void Reset()
     {
-        if (m_handle && m_handle.promise().Release() == 0)
+        if (m_handle && m_handle.promise().Detach())
         {
             m_handle.destroy();
         }
@@ -127,7 +221,6 @@ private:
 template <Concepts::TaskImpl T, typename R>
 Task<R, T> Detail::PromiseType<T, R>::get_return_object()
 {
-    this->AddRef();
     return Task<R, T>{
         std::coroutine_handle<PromiseType<T, R>>::from_promise(*this)};
 }
@@ -0,0 +1,319 @@
+/// @file TaskContext.h
+/// Typed values inherited by coroutines from the code that creates them.
+///
+
+#ifndef CORTADO_TASK_CONTEXT_H
+#define CORTADO_TASK_CONTEXT_H
+
+// STL
+//
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Cortado
+{
+
+namespace Detail
+{
+
+/// @brief Immutable set of context values. Shared by every coroutine of a
+/// tree until one of them overrides a slot.
+///
+struct TaskContextNode
+{
+    std::atomic_size_t RefCount{1};
+    std::vector<std::shared_ptr<const void>> Slots;
+};
+
+/// @brief Allocate an index for a new context slot.
+/// @returns Slot index.
+///
+inline std::size_t NextTaskContextSlotIndex() noexcept
+{
+    static std::atomic_size_t next{0};
+    return next.fetch_add(1, std::memory_order::relaxed);
+}
+
+} // namespace Detail
+
+/// @brief Thread-local storage of the context of currently running code.
+/// Holds a non-owning pointer: the owner is a running coroutine or a
+/// @link Cortado::TaskContextScope TaskContextScope@endlink, so switching
+/// contexts costs a pointer store and no reference counting.
+///
+struct TaskContextTLS
+{
+    /// @brief Get context of the current thread.
+    /// @returns Context node, nullptr if context is empty.
+    ///
+    inline static const Detail::TaskContextNode *Get()
+    {
+        return GetImpl();
+    }
+
+    /// @brief Set context of the current thread.
+    /// @param node Context node.
+    ///
+    inline static void Set(const Detail::TaskContextNode *node)
+    {
+        GetImpl() = node;
+    }
+
+    /// @brief Set context of the current thread.
+    /// @param node Context node.
+    /// @returns Context the thread had before.
+    ///
+    inline static const Detail::TaskContextNode *Exchange(
+        const Detail::TaskContextNode *node)
+    {
+        return std::exchange(GetImpl(), node);
+    }
+
+private:
+    static const Detail::TaskContextNode *&GetImpl()
+    {
+        static thread_local const Detail::TaskContextNode *current = nullptr;
+        return current;
+    }
+};
+
+/// @brief Key of a typed value in the task context. Every slot gets its own
+/// index at construction, so lookup is a bounds check and an array access.
+/// Declare slots as globals, e.g. `inline const ContextSlot<TraceId> Trace;`.
+/// @tparam T Value type.
+///
+template <typename T>
+class ContextSlot
+{
+public:
+    /// @brief Constructor. Allocates slot index.
+    ///
+    ContextSlot() noexcept : m_index{Detail::NextTaskContextSlotIndex()}
+    {
+    }
+
+    /// @brief Non-copyable.
+    ///
+    ContextSlot(const ContextSlot &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    ContextSlot &operator=(const ContextSlot &) = delete;
+
+    /// @brief Get value of currently running code.
+    /// @returns Pointer to value, nullptr if the slot is not set.
+    ///
+    const T *Get() const noexcept
+    {
+        return Get(TaskContextTLS::Get());
+    }
+
+    /// @brief Get value from a context node.
+    /// @param node Context node, may be nullptr.
+    /// @returns Pointer to value, nullptr if the slot is not set.
+    ///
+    const T *Get(const Detail::TaskContextNode *node) const noexcept
+    {
+        if (node == nullptr || m_index >= node->Slots.size())
+        {
+            return nullptr;
+        }
+
+        return static_cast<const T *>(node->Slots[m_index].get());
+    }
+
+    /// @brief Get slot index.
+    ///
+    std::size_t Index() const noexcept
+    {
+        return m_index;
+    }
+
+private:
+    std::size_t m_index;
+};
+
+/// @brief Owning reference to an immutable set of context values.
+///
+class TaskContext
+{
+public:
+    /// @brief Constructs an empty context.
+    ///
+    TaskContext() noexcept = default;
+
+    /// @brief Copy constructor. Shares the values.
+    ///
+    TaskContext(const TaskContext &other) noexcept : m_node{other.m_node}
+    {
+        AddRef(m_node);
+    }
+
+    /// @brief Move constructor.
+    ///
+    TaskContext(TaskContext &&other) noexcept :
+        m_node{std::exchange(other.m_node, nullptr)}
+    {
+    }
+
+    /// @brief Copy assignment.
+    ///
+    TaskContext &operator=(const TaskContext &other) noexcept
+    {
+        AddRef(other.m_node);
+        Release(std::exchange(m_node, other.m_node));
+        return *this;
+    }
+
+    /// @brief Move assignment.
+    ///
+    TaskContext &operator=(TaskContext &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Release(
+                std::exchange(m_node, std::exchange(other.m_node, nullptr)));
+        }
+        return *this;
+    }
+
+    /// @brief Destructor.
+    ///
+    ~TaskContext()
+    {
+        Release(m_node);
+    }
+
+    /// @brief Get context of currently running code.
+    /// @returns Shared reference to the context.
+    ///
+    static TaskContext Current() noexcept
+    {
+        auto *node = const_cast<Detail::TaskContextNode *>(
+            TaskContextTLS::Get());
+        AddRef(node);
+        return TaskContext{node};
+    }
+
+    /// @brief Copy-on-write override of a slot. This context is unchanged;
+    /// other slots are shared with it by pointer.
+    /// @param slot Slot to set.
+    /// @param value Value.
+    /// @returns New context.
+    ///
+    template <typename T, typename U>
+    TaskContext With(const ContextSlot<T> &slot, U &&value) const
+    {
+        auto *node = new Detail::TaskContextNode{};
+        if (m_node != nullptr)
+        {
+            node->Slots = m_node->Slots;
+        }
+
+        if (slot.Index() >= node->Slots.size())
+        {
+            node->Slots.resize(slot.Index() + 1);
+        }
+
+        node->Slots[slot.Index()] =
+            std::make_shared<const T>(std::forward<U>(value));
+
+        return TaskContext{node};
+    }
+
+    /// @brief Get value of a slot.
+    /// @param slot Slot to read.
+    /// @returns Pointer to value, nullptr if the slot is not set.
+    ///
+    template <typename T>
+    const T *Get(const ContextSlot<T> &slot) const noexcept
+    {
+        return slot.Get(m_node);
+    }
+
+    /// @brief Get underlying node to publish in TLS.
+    ///
+    const Detail::TaskContextNode *Node() const noexcept
+    {
+        return m_node;
+    }
+
+private:
+    explicit TaskContext(Detail::TaskContextNode *node) noexcept :
+        m_node{node}
+    {
+    }
+
+    static void AddRef(Detail::TaskContextNode *node) noexcept
+    {
+        if (node != nullptr)
+        {
+            node->RefCount.fetch_add(1, std::memory_order::relaxed);
+        }
+    }
+
+    static void Release(Detail::TaskContextNode *node) noexcept
+    {
+        if (node != nullptr &&
+            node->RefCount.fetch_sub(1, std::memory_order::acq_rel) == 1)
+        {
+            delete node;
+        }
+    }
+
+    Detail::TaskContextNode *m_node{nullptr};
+};
+
+/// @brief RAII helper which overrides a slot for all coroutines created in
+/// its scope. Must not span a suspension point.
+///
+class TaskContextScope
+{
+public:
+    /// @brief Constructor. Switches current thread to the context.
+    /// @param context Context.
+    ///
+    explicit TaskContextScope(TaskContext context) :
+        m_context{std::move(context)},
+        m_previous{TaskContextTLS::Exchange(m_context.Node())}
+    {
+    }
+
+    /// @brief Constructor. Switches current thread to a copy of its context
+    /// with one slot overridden.
+    /// @param slot Slot to set.
+    /// @param value Value.
+    ///
+    template <typename T, typename U>
+    TaskContextScope(const ContextSlot<T> &slot, U &&value) :
+        TaskContextScope{
+            TaskContext::Current().With(slot, std::forward<U>(value))}
+    {
+    }
+
+    /// @brief Non-copyable.
+    ///
+    TaskContextScope(const TaskContextScope &) = delete;
+
+    /// @brief Non-copyable.
+    ///
+    TaskContextScope &operator=(const TaskContextScope &) = delete;
+
+    /// @brief Destructor. Restores previous context.
+    ///
+    ~TaskContextScope()
+    {
+        TaskContextTLS::Set(m_previous);
+    }
+
+private:
+    TaskContext m_context;
+    const Detail::TaskContextNode *m_previous;
+};
+
+} // namespace Cortado
+
+#endif // CORTADO_TASK_CONTEXT_H
@@ -0,0 +1,185 @@
+/// @file ValueTask.h
+/// Task which may hold an already available result instead of a coroutine.
+///
+
+#ifndef CORTADO_VALUE_TASK_H
+#define CORTADO_VALUE_TASK_H
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Task.h>
+
+// STL
+//
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace Cortado
+{
+
+/// @brief Return type for functions that often have their result at hand,
+/// e.g. a cache lookup. It holds either the result itself, created with
+/// `FromResult` without a coroutine frame, or a running `Task`. Awaiting or
+/// getting a ready result allocates nothing and touches no atomics; callers
+/// use the same code for both cases.
+/// @tparam R Result type.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink of the
+/// coroutine for the slow path.
+///
+template <typename R = void, Concepts::TaskImpl T = DefaultTaskImpl>
+class ValueTask
+{
+public:
+    struct Awaiter;
+
+    /// @brief Result storage for the ready case.
+    ///
+    using ValueT = std::conditional_t<std::is_void_v<R>, std::monostate, R>;
+
+    /// @brief Constructor. Wraps a running coroutine.
+    /// @param task Task to take over.
+    ///
+    ValueTask(Task<R, T> &&task) :
+        m_state{std::in_place_index<1>, std::move(task)}
+    {
+    }
+
+    /// @brief Create a ready task.
+    /// @param value Result.
+    /// @returns Ready task.
+    ///
+    template <typename U>
+        requires(!std::is_void_v<R> && std::is_constructible_v<R, U>)
+    static ValueTask FromResult(U &&value)
+    {
+        return ValueTask{std::in_place_index<0>, std::forward<U>(value)};
+    }
+
+    /// @brief Create a ready task without result.
+    /// @returns Ready task.
+    ///
+    static ValueTask FromResult()
+        requires std::is_void_v<R>
+    {
+        return ValueTask{std::in_place_index<0>};
+    }
+
+    /// @brief Test if task is completed.
+    /// @returns true if result is at hand or coroutine has completed.
+    ///
+    bool IsReady() const
+    {
+        const auto *task = std::get_if<1>(&m_state);
+        return task == nullptr || task->IsReady();
+    }
+
+    /// @brief Get task result, waiting for the coroutine if needed.
+    /// @returns Task result.
+    /// @throws Exception if present.
+    ///
+    R Get()
+        requires Concepts::HasEvent<T>
+    {
+        if (auto *task = std::get_if<1>(&m_state))
+        {
+            return task->Get();
+        }
+
+        if constexpr (!std::is_void_v<R>)
+        {
+            return std::move(*std::get_if<0>(&m_state));
+        }
+    }
+
+private:
+    template <typename... Args>
+    explicit ValueTask(std::in_place_index_t<0> ready, Args &&...args) :
+        m_state{ready, std::forward<Args>(args)...}
+    {
+    }
+
+    std::variant<ValueT, Task<R, T>> m_state;
+};
+
+/// @brief ValueTask awaiter. A ready result is handed over without
+/// suspension, otherwise the coroutine is awaited like a `Task`.
+/// @tparam R Result type.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+///
+template <typename R, Concepts::TaskImpl T>
+struct ValueTask<R, T>::Awaiter
+{
+    /// @brief Constructor. Takes over the task.
+    /// @param task Task to await.
+    ///
+    Awaiter(ValueTask<R, T> &&task) : m_state{Take(std::move(task))}
+    {
+    }
+
+    /// @brief Compiler contract: A ready result resumes immediately.
+    ///
+    bool await_ready()
+    {
+        auto *awaiter = std::get_if<1>(&m_state);
+        return awaiter == nullptr || awaiter->await_ready();
+    }
+
+    /// @brief Compiler contract: Suspend on the coroutine. Only called if
+    /// there is one.
+    ///
+    template <typename PromiseT>
+    auto await_suspend(std::coroutine_handle<PromiseT> h)
+    {
+        return std::get_if<1>(&m_state)->await_suspend(h);
+    }
+
+    /// @brief Compiler contract: Take the result.
+    ///
+    R await_resume()
+    {
+        if (auto *awaiter = std::get_if<1>(&m_state))
+        {
+            return awaiter->await_resume();
+        }
+
+        if constexpr (!std::is_void_v<R>)
+        {
+            return std::move(*std::get_if<0>(&m_state));
+        }
+    }
+
+private:
+    using TaskAwaiterT = typename Task<R, T>::TaskAwaiter;
+    using StateT = std::variant<ValueT, TaskAwaiterT>;
+
+    static StateT Take(ValueTask<R, T> &&task)
+    {
+        if (auto *running = std::get_if<1>(&task.m_state))
+        {
+            return StateT{std::in_place_index<1>, std::move(*running)};
+        }
+
+        return StateT{std::in_place_index<0>,
+                      std::move(*std::get_if<0>(&task.m_state))};
+    }
+
+    StateT m_state;
+};
+
+/// @brief Compiler contract: co_await operator implementation for value
+/// tasks.
+/// @tparam R Result type.
+/// @tparam T @link Cortado::Concepts::TaskImpl TaskImpl@endlink.
+/// @returns ValueTask awaiter.
+///
+template <typename R, Concepts::TaskImpl T>
+inline auto operator co_await(ValueTask<R, T> &&task)
+{
+    return typename ValueTask<R, T>::Awaiter{std::move(task)};
+}
+
+} // namespace Cortado
+
+#endif // CORTADO_VALUE_TASK_H
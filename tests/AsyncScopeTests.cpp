@@ -0,0 +1,162 @@
+/// @file AsyncScopeTests.cpp
+/// Tests for Cortado::AsyncScope.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/AsyncEvent.h>
+#include <Cortado/AsyncScope.h>
+#include <Cortado/Await.h>
+#include <Cortado/LazyTask.h>
+
+// STL
+//
+#include <atomic>
+#include <memory>
+
+namespace
+{
+
+using AsyncScope = Cortado::AsyncScope<std::atomic_int64_t>;
+using Event = Cortado::AsyncEvent<std::atomic_int64_t>;
+
+Cortado::Task<> Increment(std::atomic_int &counter)
+{
+    co_await Cortado::ResumeBackground();
+    ++counter;
+}
+
+Cortado::Task<> WaitEvent(Event &event)
+{
+    co_await event.WaitAsync();
+}
+
+Cortado::Task<> HoldUntil(Event &event,
+                          [[maybe_unused]] std::shared_ptr<int> held)
+{
+    co_await event.WaitAsync();
+}
+
+} // namespace
+
+TEST(AsyncScopeTests, Join_WhenNothingSpawned_Completes)
+{
+    AsyncScope scope;
+
+    auto task = [](AsyncScope &scope) -> Cortado::Task<>
+    { co_await scope.Join(); };
+
+    task(scope).Get();
+
+    EXPECT_EQ(0u, scope.Outstanding());
+}
+
+TEST(AsyncScopeTests, Join_WhenTasksSpawned_WaitsAll)
+{
+    constexpr int TaskCount = 100;
+
+    AsyncScope scope;
+    std::atomic_int counter{0};
+
+    auto task = [](AsyncScope &scope, std::atomic_int &counter)
+        -> Cortado::Task<int>
+    {
+        for (int i = 0; i < TaskCount; ++i)
+        {
+            scope.Spawn(Increment(counter));
+        }
+
+        co_await scope.Join();
+        co_return counter.load();
+    };
+
+    EXPECT_EQ(TaskCount, task(scope, counter).Get());
+    EXPECT_EQ(0u, scope.Outstanding());
+}
+
+TEST(AsyncScopeTests, Outstanding_WhenTasksPending_Counted)
+{
+    AsyncScope scope;
+    Event event;
+
+    scope.Spawn(WaitEvent(event));
+    scope.Spawn(WaitEvent(event));
+
+    EXPECT_EQ(2u, scope.Outstanding());
+
+    auto join = [](AsyncScope &scope) -> Cortado::Task<>
+    { co_await scope.Join(); };
+
+    auto joined = join(scope);
+    EXPECT_FALSE(joined.IsReady());
+    EXPECT_EQ(2u, scope.Outstanding());
+
+    event.Set();
+
+    joined.Get();
+    EXPECT_EQ(0u, scope.Outstanding());
+}
+
+TEST(AsyncScopeTests, Spawn_WhenLazyTask_Started)
+{
+    AsyncScope scope;
+    bool ran = false;
+
+    auto lazy = [](bool &ran) -> Cortado::LazyTask<>
+    {
+        ran = true;
+        co_return;
+    };
+
+    scope.Spawn(lazy(ran));
+
+    EXPECT_TRUE(ran);
+    EXPECT_EQ(0u, scope.Outstanding());
+}
+
+TEST(AsyncScopeTests, Join_WhenCalledAgain_WaitsNewTasks)
+{
+    AsyncScope scope;
+    std::atomic_int counter{0};
+
+    auto task = [](AsyncScope &scope, std::atomic_int &counter)
+        -> Cortado::Task<>
+    {
+        scope.Spawn(Increment(counter));
+        co_await scope.Join();
+
+        scope.Spawn(Increment(counter));
+        co_await scope.Join();
+    };
+
+    task(scope, counter).Get();
+
+    EXPECT_EQ(2, counter.load());
+}
+
+TEST(AsyncScopeTests, Join_WhenLastTaskWakesJoiner_FramesFreed)
+{
+    AsyncScope scope;
+    Event event;
+    auto held = std::make_shared<int>(42);
+    std::weak_ptr<int> observer = held;
+
+    scope.Spawn(HoldUntil(event, std::move(held)));
+
+    auto joiner = [](AsyncScope &scope,
+                     std::weak_ptr<int> &observer) -> Cortado::Task<bool>
+    {
+        co_await scope.Join();
+        co_return observer.expired();
+    };
+
+    auto task = joiner(scope, observer);
+
+    // The spawned task completes and wakes the joiner on this thread.
+    //
+    event.Set();
+
+    EXPECT_TRUE(task.Get()) << "Spawned frame must be freed before Join";
+}
@@ -0,0 +1,138 @@
+/// @file AwaitTransformTests.cpp
+/// Tests for TaskImpl-provided await_transform policies.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Common/AwaitObserver.h>
+
+// STL
+//
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+
+struct AwaitCounters
+{
+    std::atomic_int Started{0};
+    std::atomic_int Suspended{0};
+    std::atomic_int Resumed{0};
+};
+
+AwaitCounters g_counters;
+
+struct CountingObserver
+{
+    CountingObserver()
+    {
+        ++g_counters.Started;
+    }
+
+    void OnSuspend()
+    {
+        ++g_counters.Suspended;
+    }
+
+    void OnResume()
+    {
+        ++g_counters.Resumed;
+    }
+};
+
+struct ObservedTaskImpl :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::ObservedAwaits<CountingObserver>
+{
+};
+
+static_assert(Cortado::Concepts::AwaitTransform<ObservedTaskImpl>);
+static_assert(!Cortado::Concepts::AwaitTransform<Cortado::DefaultTaskImpl>);
+
+template <typename T = void>
+using Task = Cortado::Task<T, ObservedTaskImpl>;
+
+/// @brief Budget which fails every `co_await` once exhausted.
+///
+struct BudgetObserver
+{
+    static inline thread_local int Budget = 0;
+
+    void OnResume()
+    {
+        if (--Budget < 0)
+        {
+            throw std::runtime_error{"budget exhausted"};
+        }
+    }
+};
+
+struct BudgetTaskImpl :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::ObservedAwaits<BudgetObserver>
+{
+};
+
+Cortado::Task<int> Plain()
+{
+    co_return 1;
+}
+
+} // namespace
+
+TEST(AwaitTransformTests, AwaitTransform_WhenPolicyPresent_EveryAwaitObserved)
+{
+    g_counters.Started = 0;
+    g_counters.Suspended = 0;
+    g_counters.Resumed = 0;
+
+    Cortado::DefaultEvent event;
+    event.Set();
+
+    auto task = [](Cortado::DefaultEvent &event) -> Task<int>
+    {
+        int sum = co_await Plain();
+        co_await event.WaitAsync();
+        co_await Cortado::ResumeBackground();
+        co_await std::suspend_never{};
+        co_return sum + 1;
+    };
+
+    EXPECT_EQ(2, task(event).Get());
+
+    EXPECT_EQ(4, g_counters.Started.load());
+    EXPECT_EQ(1, g_counters.Suspended.load()) << "Only the hop suspends";
+    EXPECT_EQ(4, g_counters.Resumed.load());
+}
+
+TEST(AwaitTransformTests, AwaitTransform_WhenResultMoveOnly_PassedThrough)
+{
+    auto child = []() -> Task<std::unique_ptr<int>>
+    { co_return std::make_unique<int>(7); };
+
+    auto task = [&]() -> Task<int>
+    {
+        auto value = co_await child();
+        co_return *value;
+    };
+
+    EXPECT_EQ(7, task().Get());
+}
+
+TEST(AwaitTransformTests, AwaitTransform_WhenObserverThrows_AwaitFails)
+{
+    BudgetObserver::Budget = 1;
+
+    auto task = []() -> Cortado::Task<int, BudgetTaskImpl>
+    {
+        int first = co_await Plain();
+        int second = co_await Plain();
+        co_return first + second;
+    };
+
+    EXPECT_THROW(task().Get(), std::runtime_error);
+}
@@ -0,0 +1,143 @@
+/// @file BusyPollingSchedulerTests.cpp
+/// Tests for Cortado::Common::BusyPollingCoroutineScheduler.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Common/BusyPollingCoroutineScheduler.h>
+
+// STL
+//
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Scheduler = Cortado::Common::BusyPollingCoroutineScheduler;
+
+struct BusyPollingTaskImpl :
+    Cortado::Common::STLAtomic,
+    Cortado::Common::STLCoroutineAllocator,
+    Cortado::Common::STLExceptionHandler,
+    Scheduler
+{
+    using Event = Cortado::DefaultEvent;
+};
+
+static_assert(Cortado::Concepts::BackgroundResumable<BusyPollingTaskImpl>);
+
+template <typename T = void>
+using Task = Cortado::Task<T, BusyPollingTaskImpl>;
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+} // namespace
+
+TEST(BusyPollingSchedulerTests, ResumeBackground_Success)
+{
+    auto task = []() -> Task<ThreadIdT>
+    {
+        co_await Cortado::ResumeBackground();
+        co_return std::this_thread::get_id();
+    };
+
+    EXPECT_NE(std::this_thread::get_id(), task().Get());
+}
+
+TEST(BusyPollingSchedulerTests, Schedule_WhenManyProducers_AllResumed)
+{
+    constexpr std::size_t ProducerCount = 4;
+    constexpr std::size_t TasksPerProducer = 500;
+
+    Scheduler sched{2, 2};
+    std::atomic_size_t resumed{0};
+
+    auto task = [](Scheduler &sched, std::atomic_size_t &resumed) -> Task<>
+    {
+        using Cortado::operator co_await;
+        co_await sched;
+        ++resumed;
+    };
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < ProducerCount; ++p)
+    {
+        producers.emplace_back(
+            [&]
+            {
+                for (std::size_t i = 0; i < TasksPerProducer; ++i)
+                {
+                    task(sched, resumed).Get();
+                }
+            });
+    }
+
+    for (auto &t : producers)
+    {
+        t.join();
+    }
+
+    EXPECT_EQ(ProducerCount * TasksPerProducer, resumed.load());
+}
+
+TEST(BusyPollingSchedulerTests, Schedule_WhenWorkerReschedulesItself_NoDeadlock)
+{
+    Scheduler sched{1, 1};
+
+    auto task = [](Scheduler &sched) -> Task<int>
+    {
+        using Cortado::operator co_await;
+
+        int hops = 0;
+        for (; hops < 100; ++hops)
+        {
+            co_await sched;
+        }
+        co_return hops;
+    };
+
+    auto t1 = task(sched);
+    auto t2 = task(sched);
+
+    EXPECT_EQ(100, t1.Get());
+    EXPECT_EQ(100, t2.Get());
+}
+
+TEST(BusyPollingSchedulerTests,
+     Destructor_WhenWorkersRescheduleAcrossPool_AllResumed)
+{
+    constexpr std::size_t TaskCount = 8;
+    constexpr int Hops = 1'000;
+
+    std::atomic_size_t completed{0};
+    std::vector<Task<>> tasks;
+
+    auto task = [](Scheduler &sched, std::atomic_size_t &completed) -> Task<>
+    {
+        using Cortado::operator co_await;
+
+        // Every hop goes to the next worker in round-robin order, so workers
+        // keep filling each other's mailboxes while the pool drains.
+        //
+        for (int i = 0; i < Hops; ++i)
+        {
+            co_await sched;
+        }
+        ++completed;
+    };
+
+    {
+        Scheduler sched{2, 2};
+        for (std::size_t i = 0; i < TaskCount; ++i)
+        {
+            tasks.push_back(task(sched, completed));
+        }
+    }
+
+    EXPECT_EQ(TaskCount, completed.load());
+}
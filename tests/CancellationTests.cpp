@@ -0,0 +1,325 @@
+/// @file CancellationTests.cpp
+/// Tests for cooperative cancellation of tasks and built-in awaiters.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/AsyncMutex.h>
+#include <Cortado/Await.h>
+#include <Cortado/Common/CancellationPropagation.h>
+
+// STL
+//
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct CancellableTaskImpl :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::CancellationPreAndPostActions
+{
+};
+
+static_assert(Cortado::Concepts::Cancellable<CancellableTaskImpl>);
+static_assert(!Cortado::Concepts::Cancellable<Cortado::DefaultTaskImpl>);
+
+template <typename T = void>
+using Task = Cortado::Task<T, CancellableTaskImpl>;
+
+using AsyncMutex = Cortado::AsyncMutex<std::atomic_int64_t>;
+
+Task<int> WaitForEvent(Cortado::DefaultEvent &event)
+{
+    co_await event.WaitAsync();
+    co_return 42;
+}
+
+} // namespace
+
+TEST(CancellationTests, EventAwaiter_WhenCancelled_ResumedWithOperationStopped)
+{
+    Cortado::CancellationSource source;
+    Cortado::DefaultEvent event;
+
+    auto task = [&]
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        return WaitForEvent(event);
+    }();
+
+    EXPECT_FALSE(task.IsReady());
+
+    source.request_stop();
+
+    EXPECT_TRUE(task.IsReady()) << "Cancelled coroutine must resume at once";
+    EXPECT_THROW(task.Get(), Cortado::OperationStopped);
+
+    event.Set();
+}
+
+TEST(CancellationTests, CoAwait_WhenParentCancelled_ChildCancelled)
+{
+    Cortado::CancellationSource source;
+    Cortado::DefaultEvent event;
+
+    auto parent = [](Cortado::DefaultEvent &event) -> Task<int>
+    {
+        co_return co_await WaitForEvent(event) + 1;
+    };
+
+    auto task = [&]
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        return parent(event);
+    }();
+
+    source.request_stop();
+
+    EXPECT_THROW(task.Get(), Cortado::OperationStopped);
+}
+
+TEST(CancellationTests, EventAwaiter_WhenNotCancellableTaskImpl_NotCancelled)
+{
+    Cortado::CancellationSource source;
+    Cortado::DefaultEvent event;
+
+    auto waiter = [](Cortado::DefaultEvent &event) -> Cortado::Task<int>
+    {
+        co_await event.WaitAsync();
+        co_return 42;
+    };
+
+    auto task = [&]
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        return waiter(event);
+    }();
+
+    source.request_stop();
+
+    EXPECT_FALSE(task.IsReady());
+
+    event.Set();
+
+    EXPECT_EQ(42, task.Get());
+}
+
+TEST(CancellationTests, ResumeBackground_WhenAlreadyCancelled_DoesNotHop)
+{
+    Cortado::CancellationSource source;
+    source.request_stop();
+
+    auto task = []() -> Task<>
+    {
+        co_await Cortado::ResumeBackground();
+        ADD_FAILURE() << "Cancelled coroutine must not continue";
+    };
+
+    auto t = [&]
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        return task();
+    }();
+
+    EXPECT_TRUE(t.IsReady());
+    EXPECT_THROW(t.Get(), Cortado::OperationStopped);
+}
+
+TEST(CancellationTests, LockAwaiter_WhenCancelled_OtherWaitersKeepOrder)
+{
+    AsyncMutex mutex;
+    Cortado::CancellationSource source;
+    std::vector<int> order;
+
+    auto locker = [](AsyncMutex &mutex, std::vector<int> &order, int id)
+        -> Task<>
+    {
+        auto lock = co_await mutex.ScopedLockAsync();
+        order.push_back(id);
+    };
+
+    ASSERT_TRUE(mutex.TryLock());
+
+    auto first = locker(mutex, order, 1);
+    auto cancelled = [&]
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        return locker(mutex, order, 2);
+    }();
+    auto third = locker(mutex, order, 3);
+
+    source.request_stop();
+    EXPECT_THROW(cancelled.Get(), Cortado::OperationStopped);
+
+    mutex.Unlock();
+
+    first.Get();
+    third.Get();
+
+    EXPECT_EQ((std::vector<int>{1, 3}), order);
+    EXPECT_TRUE(mutex.TryLock()) << "Cancelled waiter must not hold the lock";
+    mutex.Unlock();
+}
+
+TEST(CancellationTests, RequestStop_WhenManySuspended_AllFramesFreed)
+{
+    constexpr std::size_t CoroutineCount = 10'000;
+
+    Cortado::CancellationSource source;
+    Cortado::DefaultEvent event;
+    auto alive = std::make_shared<int>(0);
+    std::weak_ptr<int> observer = alive;
+
+    auto waiter = [](Cortado::DefaultEvent &event,
+                     [[maybe_unused]] std::shared_ptr<int> captured) -> Task<>
+    {
+        co_await event.WaitAsync();
+    };
+
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        for (std::size_t i = 0; i < CoroutineCount; ++i)
+        {
+            // Dropped right away: the coroutine owns its frame.
+            //
+            waiter(event, alive);
+        }
+    }
+
+    alive.reset();
+    EXPECT_FALSE(observer.expired());
+
+    source.request_stop();
+
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST(CancellationTests, RequestStop_WhenRacingWithSet_ResumedOnce)
+{
+    constexpr int Iterations = 2'000;
+
+    for (int i = 0; i < Iterations; ++i)
+    {
+        Cortado::CancellationSource source;
+        Cortado::DefaultEvent event;
+        std::atomic_int resumed{0};
+
+        auto waiter = [](Cortado::DefaultEvent &event,
+                         std::atomic_int &resumed) -> Task<>
+        {
+            try
+            {
+                co_await event.WaitAsync();
+            }
+            catch (const Cortado::OperationStopped &)
+            {
+            }
+            ++resumed;
+        };
+
+        std::vector<Task<>> tasks;
+        {
+            Cortado::CancellationScope scope{source.get_token()};
+            for (int j = 0; j < 4; ++j)
+            {
+                tasks.push_back(waiter(event, resumed));
+            }
+        }
+
+        std::thread canceller{[&] { source.request_stop(); }};
+        event.Set();
+        canceller.join();
+
+        for (auto &t : tasks)
+        {
+            t.Get();
+        }
+
+        ASSERT_EQ(4, resumed.load());
+    }
+}
+
+TEST(CancellationTests, LockAwaiter_WhenRacingWithUnlock_LockStaysConsistent)
+{
+    constexpr int WorkerCount = 8;
+    constexpr int Iterations = 200;
+
+    AsyncMutex mutex;
+    int counter = 0;
+    std::atomic_int acquired{0};
+
+    auto worker = [](AsyncMutex &mutex,
+                     int &counter,
+                     std::atomic_int &acquired) -> Task<>
+    {
+        co_await Cortado::ResumeBackground();
+
+        for (int i = 0; i < Iterations; ++i)
+        {
+            try
+            {
+                auto lock = co_await mutex.ScopedLockAsync();
+                ++counter;
+                ++acquired;
+            }
+            catch (const Cortado::OperationStopped &)
+            {
+                co_return;
+            }
+        }
+    };
+
+    Cortado::CancellationSource source;
+    std::vector<Task<>> tasks;
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        for (int i = 0; i < WorkerCount; ++i)
+        {
+            tasks.push_back(worker(mutex, counter, acquired));
+        }
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    source.request_stop();
+
+    for (auto &t : tasks)
+    {
+        try
+        {
+            t.Get();
+        }
+        catch (const Cortado::OperationStopped &)
+        {
+        }
+    }
+
+    EXPECT_EQ(acquired.load(), counter);
+    EXPECT_TRUE(mutex.TryLock());
+    mutex.Unlock();
+}
+
+TEST(CancellationTests, Cancel_WhenResumedOnCallerThread_CallerTokenRestored)
+{
+    Cortado::CancellationSource source;
+    Cortado::DefaultEvent event;
+
+    auto task = [&]
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        return WaitForEvent(event);
+    }();
+
+    source.request_stop();
+
+    EXPECT_THROW(task.Get(), Cortado::OperationStopped);
+    EXPECT_FALSE(Cortado::IsCancellationRequested())
+        << "Cancelled coroutine must not leave its token on this thread";
+
+    event.Set();
+}
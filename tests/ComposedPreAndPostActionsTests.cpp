@@ -0,0 +1,179 @@
+/// @file ComposedPreAndPostActionsTests.cpp
+/// Tests for Cortado::Common::ComposedPreAndPostActions.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Common/CancellationPropagation.h>
+#include <Cortado/Common/ComposedPreAndPostActions.h>
+#include <Cortado/Common/DeadlinePropagation.h>
+#include <Cortado/Common/PriorityCoroutineScheduler.h>
+#include <Cortado/Common/TaskContextPropagation.h>
+#include <Cortado/Common/WeightedFairCoroutineScheduler.h>
+
+// STL
+//
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct ComposedTaskImpl :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::ComposedPreAndPostActions<
+        Cortado::Common::CancellationPreAndPostActions,
+        Cortado::Common::DeadlinePreAndPostActions,
+        Cortado::Common::TaskContextPreAndPostActions,
+        Cortado::Common::TenantPreAndPostActions>
+{
+};
+
+static_assert(Cortado::Concepts::Cancellable<ComposedTaskImpl>);
+static_assert(Cortado::Concepts::DeadlineAware<ComposedTaskImpl>);
+static_assert(Cortado::Concepts::HandOverAction<ComposedTaskImpl>);
+static_assert(Cortado::Concepts::CompletionAction<ComposedTaskImpl>);
+
+struct ContextOnlyTaskImpl :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::ComposedPreAndPostActions<
+        Cortado::Common::TaskContextPreAndPostActions>
+{
+};
+
+static_assert(!Cortado::Concepts::Cancellable<ContextOnlyTaskImpl>);
+static_assert(!Cortado::Concepts::HandOverAction<ContextOnlyTaskImpl>);
+
+template <typename T = void>
+using Task = Cortado::Task<T, ComposedTaskImpl>;
+
+const Cortado::ContextSlot<std::string> TraceSlot;
+
+/// @brief Everything a coroutine inherits from its creator.
+///
+struct Inherited
+{
+    bool StopPossible = false;
+    int Priority = 0;
+    std::string Trace;
+    Cortado::Common::TenantId Tenant = 0;
+};
+
+Task<Inherited> ReadInheritedInBackground()
+{
+    co_await Cortado::ResumeBackground();
+
+    const Cortado::CancellationToken *token = Cortado::CancellationTLS::Get();
+    const std::string *trace = TraceSlot.Get();
+    co_return Inherited{
+        .StopPossible = token != nullptr && token->stop_possible(),
+        .Priority = Cortado::SchedulingTLS::Get().Priority,
+        .Trace = trace != nullptr ? *trace : std::string{},
+        .Tenant = Cortado::Common::TenantTLS::Get()};
+}
+
+Task<int> WaitForEvent(Cortado::DefaultEvent &event)
+{
+    co_await event.WaitAsync();
+    co_return 42;
+}
+
+} // namespace
+
+TEST(ComposedPreAndPostActionsTests, Child_WhenResumedOnOtherThread_InheritsAll)
+{
+    Cortado::CancellationSource source;
+
+    auto task = [&]
+    {
+        Cortado::CancellationScope cancellation{source.get_token()};
+        Cortado::SchedulingScope scheduling{
+            Cortado::SchedulingAttributes{.Priority = 3}};
+        Cortado::TaskContextScope context{TraceSlot, "request-1"};
+        Cortado::Common::TenantScope tenant{7};
+        return ReadInheritedInBackground();
+    }();
+
+    auto inherited = task.Get();
+
+    EXPECT_TRUE(inherited.StopPossible);
+    EXPECT_EQ(3, inherited.Priority);
+    EXPECT_EQ("request-1", inherited.Trace);
+    EXPECT_EQ(7u, inherited.Tenant);
+
+    EXPECT_EQ(nullptr, Cortado::CancellationTLS::Get());
+    EXPECT_EQ(0, Cortado::SchedulingTLS::Get().Priority);
+    EXPECT_EQ(nullptr, TraceSlot.Get());
+    EXPECT_EQ(0u, Cortado::Common::TenantTLS::Get());
+}
+
+TEST(ComposedPreAndPostActionsTests,
+     EventAwaiter_WhenCancelled_ResumedWithOperationStopped)
+{
+    Cortado::CancellationSource source;
+    Cortado::DefaultEvent event;
+
+    auto task = [&]
+    {
+        Cortado::CancellationScope scope{source.get_token()};
+        return WaitForEvent(event);
+    }();
+
+    source.request_stop();
+
+    EXPECT_THROW(task.Get(), Cortado::OperationStopped);
+
+    event.Set();
+}
+
+TEST(ComposedPreAndPostActionsTests,
+     Schedule_WhenCoroutinesHop_QueuedByTheirPriority)
+{
+    Cortado::Common::PriorityCoroutineScheduler sched{1};
+    std::mutex lock;
+    std::vector<int> order;
+
+    auto hop = [](Cortado::Common::PriorityCoroutineScheduler &sched,
+                  std::mutex &lock,
+                  std::vector<int> &order,
+                  int priority) -> Task<>
+    {
+        using Cortado::operator co_await;
+        co_await sched;
+
+        std::lock_guard lk{lock};
+        order.push_back(priority);
+    };
+
+    std::promise<void> started;
+    std::promise<void> release;
+    sched.Post(
+        [&started, released = release.get_future()]
+        {
+            started.set_value();
+            released.wait();
+        });
+    started.get_future().wait();
+
+    std::vector<Task<>> tasks;
+    for (int priority : {1, 3, 2})
+    {
+        Cortado::SchedulingScope scope{
+            Cortado::SchedulingAttributes{.Priority = priority}};
+        tasks.push_back(hop(sched, lock, order, priority));
+    }
+
+    release.set_value();
+
+    for (auto &task : tasks)
+    {
+        task.Wait();
+    }
+
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), order);
+}
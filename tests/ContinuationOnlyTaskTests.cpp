@@ -0,0 +1,85 @@
+/// @file ContinuationOnlyTaskTests.cpp
+/// Tests for Cortado::Task<Cortado::ContinuationOnlyTaskImpl>.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+
+// STL
+//
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+template <typename T = void>
+using Task = Cortado::Task<T, Cortado::ContinuationOnlyTaskImpl>;
+
+template <typename T = void>
+using WaitableTask = Cortado::Task<T>;
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+static_assert(Cortado::Concepts::TaskImpl<Cortado::ContinuationOnlyTaskImpl>);
+static_assert(!Cortado::Concepts::HasEvent<Cortado::ContinuationOnlyTaskImpl>);
+template <typename TaskT>
+concept SyncWaitable = requires(TaskT t) { t.Get(); };
+
+static_assert(!SyncWaitable<Task<int>>, "Synchronous wait requires an event");
+static_assert(SyncWaitable<WaitableTask<int>>);
+static_assert(
+    sizeof(Cortado::Detail::PromiseType<Cortado::ContinuationOnlyTaskImpl,
+                                        int>) <
+    sizeof(Cortado::Detail::PromiseType<Cortado::DefaultTaskImpl, int>));
+
+Task<ThreadIdT> Child()
+{
+    co_await Cortado::ResumeBackground();
+    co_return std::this_thread::get_id();
+}
+
+Task<int> Throwing()
+{
+    co_await Cortado::ResumeBackground();
+    throw std::runtime_error{"Expected"};
+}
+
+} // namespace
+
+TEST(ContinuationOnlyTaskTests, CoAwait_WhenChildCompletesOnOtherThread_Success)
+{
+    auto parent = []() -> WaitableTask<ThreadIdT> { co_return co_await Child(); };
+
+    EXPECT_NE(std::this_thread::get_id(), parent().Get());
+}
+
+TEST(ContinuationOnlyTaskTests, CoAwait_WhenChildThrows_Rethrown)
+{
+    auto parent = []() -> WaitableTask<int> { co_return co_await Throwing(); };
+
+    EXPECT_THROW(parent().Get(), std::runtime_error);
+}
+
+TEST(ContinuationOnlyTaskTests, IsReady_WhenCompletedSynchronously_True)
+{
+    auto task = []() -> Task<int> { co_return 42; };
+
+    EXPECT_TRUE(task().IsReady());
+}
+
+TEST(ContinuationOnlyTaskTests, CoAwait_WhenChainOfContinuationOnlyTasks_Success)
+{
+    auto middle = []() -> Task<int>
+    {
+        co_await Child();
+        co_return 42;
+    };
+
+    auto parent = [&]() -> WaitableTask<int> { co_return co_await middle(); };
+
+    EXPECT_EQ(42, parent().Get());
+}
@@ -13,6 +13,7 @@
 // STL
 //
 #include <atomic>
+#include <type_traits>
 #include <unordered_set>
 
 struct SharedAllocatorState
@@ -215,3 +216,100 @@ TEST(CoroutineAllocatorTest, AllocationFailureBehaivor)
 
     EXPECT_THROW(taskLambda(), std::bad_alloc);
 }
+
+TEST(CoroutineAllocatorTest, AlwaysEqualAllocator_NotStoredInFrame)
+{
+    struct Pool
+    {
+        std::atomic_int AllocationCount = 0;
+        std::atomic_size_t LastAllocatedSize = 0;
+        std::atomic_size_t LastDeallocatedSize = 0;
+    };
+
+    static Pool pool;
+
+    // Not empty, but every instance refers to the same pool.
+    //
+    struct GlobalPoolAllocator
+    {
+        using is_always_equal = std::true_type;
+
+        Pool *Target = &pool;
+
+        void *allocate(std::size_t sz)
+        {
+            ++Target->AllocationCount;
+            Target->LastAllocatedSize = sz;
+            return std::malloc(sz);
+        }
+
+        void deallocate(void *ptr, std::size_t sz)
+        {
+            Target->LastDeallocatedSize = sz;
+            std::free(ptr);
+        }
+    };
+
+    static_assert(!std::is_empty_v<GlobalPoolAllocator>);
+    static_assert(Cortado::Concepts::StatelessAllocator<GlobalPoolAllocator>);
+
+    using Task =
+        Cortado::Task<int, TaskImplWithCustomAllocator<GlobalPoolAllocator>>;
+
+    auto taskLambda = []() -> Task
+    {
+        co_return 1;
+    };
+
+    EXPECT_EQ(1, taskLambda().Get());
+
+    EXPECT_EQ(1, pool.AllocationCount);
+    EXPECT_EQ(pool.LastAllocatedSize.load(), pool.LastDeallocatedSize.load())
+        << "Frame must be freed with the size it was allocated with";
+}
+
+TEST(CoroutineAllocatorTest, FrameHandleAllocator_NoCopyPerFrame)
+{
+    class PoolAllocator : public TestAllocator
+    {
+    public:
+        using FrameHandle = SharedAllocatorState *;
+
+        using TestAllocator::TestAllocator;
+
+        FrameHandle GetFrameHandle() const
+        {
+            return State.get();
+        }
+
+        static void Deallocate(FrameHandle state, void *ptr, std::size_t sz)
+        {
+            state->deallocate(ptr, sz);
+        }
+    };
+
+    static_assert(Cortado::Concepts::FrameHandleAllocator<PoolAllocator>);
+
+    using Task =
+        Cortado::Task<void, TaskImplWithCustomAllocator<PoolAllocator>>;
+
+    auto state = std::make_shared<SharedAllocatorState>();
+    PoolAllocator allocator{state};
+
+    auto taskLambda = [](PoolAllocator &) -> Task
+    {
+        co_return;
+    };
+
+    for (int i = 0; i < 10; ++i)
+    {
+        taskLambda(allocator).Get();
+    }
+
+    EXPECT_EQ(10, state->AllocationCount);
+    EXPECT_EQ(10, state->DeallocationCount);
+    EXPECT_EQ(0, state->CopyConstructedCount)
+        << "Only the handle is stored in the frame";
+    EXPECT_EQ(0, state->DestructedCount);
+    EXPECT_TRUE(state->AllocatedPointers.empty());
+}
@@ -0,0 +1,212 @@
+/// @file DeadlineTests.cpp
+/// Tests for deadline and priority propagation.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Common/DeadlinePropagation.h>
+#include <Cortado/Common/PriorityCoroutineScheduler.h>
+
+// STL
+//
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+
+struct DeadlineTaskImpl :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::DeadlinePreAndPostActions
+{
+};
+
+static_assert(Cortado::Concepts::DeadlineAware<DeadlineTaskImpl>);
+static_assert(!Cortado::Concepts::DeadlineAware<Cortado::DefaultTaskImpl>);
+
+template <typename T = void>
+using Task = Cortado::Task<T, DeadlineTaskImpl>;
+
+using Scheduler = Cortado::Common::PriorityCoroutineScheduler;
+
+/// @brief Keeps the only worker of a scheduler busy until released, so
+/// that work queued meanwhile is ordered by the scheduler.
+///
+struct WorkerBlocker
+{
+    explicit WorkerBlocker(Scheduler &sched)
+    {
+        sched.Post(
+            [this, released = Release.get_future()]
+            {
+                Started.set_value();
+                released.wait();
+            });
+        Started.get_future().wait();
+    }
+
+    std::promise<void> Started;
+    std::promise<void> Release;
+};
+
+Cortado::SchedulingAttributes WithPriority(int priority)
+{
+    return Cortado::SchedulingAttributes{.Priority = priority};
+}
+
+} // namespace
+
+TEST(DeadlineTests, Child_WhenCreatedInScope_InheritsAttributes)
+{
+    auto child = []() -> Task<Cortado::SchedulingAttributes>
+    {
+        co_await Cortado::ResumeBackground();
+        co_return Cortado::SchedulingTLS::Get();
+    };
+
+    auto parent = [&]() -> Task<Cortado::SchedulingAttributes>
+    {
+        co_await Cortado::ResumeBackground();
+        co_return co_await child();
+    };
+
+    const auto deadline = Cortado::DeadlineClock::now() + std::chrono::hours{1};
+
+    auto task = [&]
+    {
+        Cortado::SchedulingScope scope{
+            Cortado::SchedulingAttributes{.Deadline = deadline, .Priority = 5}};
+        return parent();
+    }();
+
+    auto attributes = task.Get();
+
+    EXPECT_EQ(deadline, attributes.Deadline);
+    EXPECT_EQ(5, attributes.Priority);
+    EXPECT_EQ(0, Cortado::SchedulingTLS::Get().Priority);
+}
+
+TEST(DeadlineTests, Scope_WhenNested_DeadlineNotExtended)
+{
+    Cortado::SchedulingScope outer{std::chrono::seconds{1}};
+    const auto deadline = Cortado::SchedulingTLS::Get().Deadline;
+
+    Cortado::SchedulingScope inner{std::chrono::hours{1}};
+
+    EXPECT_EQ(deadline, Cortado::SchedulingTLS::Get().Deadline);
+}
+
+TEST(DeadlineTests, ResumeBackground_WhenDeadlinePassed_Throws)
+{
+    bool hopped = false;
+
+    auto task = [](bool &hopped) -> Task<>
+    {
+        co_await Cortado::ResumeBackground();
+        hopped = true;
+    };
+
+    auto expired = [&]
+    {
+        Cortado::SchedulingScope scope{std::chrono::nanoseconds{0}};
+        return task(hopped);
+    }();
+
+    EXPECT_THROW(expired.Get(), Cortado::OperationStopped);
+    EXPECT_FALSE(hopped);
+}
+
+TEST(DeadlineTests, Post_WhenPriorities_HighestRunsFirst)
+{
+    Scheduler sched{1};
+    std::vector<int> order;
+
+    {
+        WorkerBlocker blocker{sched};
+
+        for (int priority : {1, 3, 2})
+        {
+            sched.Post([&order, priority] { order.push_back(priority); },
+                       WithPriority(priority));
+        }
+
+        blocker.Release.set_value();
+    }
+
+    std::promise<void> done;
+    sched.Post([&] { done.set_value(); }, WithPriority(-1));
+    done.get_future().wait();
+
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), order);
+}
+
+TEST(DeadlineTests, Schedule_WhenCoroutinesHop_QueuedByTheirPriority)
+{
+    Scheduler sched{1};
+    std::mutex lock;
+    std::vector<int> order;
+
+    auto hop = [](Scheduler &sched,
+                  std::mutex &lock,
+                  std::vector<int> &order,
+                  int priority) -> Task<>
+    {
+        using Cortado::operator co_await;
+        co_await sched;
+
+        std::lock_guard lk{lock};
+        order.push_back(priority);
+    };
+
+    std::vector<Task<>> tasks;
+    {
+        WorkerBlocker blocker{sched};
+
+        for (int priority : {1, 3, 2})
+        {
+            Cortado::SchedulingScope scope{WithPriority(priority)};
+            tasks.push_back(hop(sched, lock, order, priority));
+        }
+
+        EXPECT_EQ(0, Cortado::SchedulingTLS::Get().Priority);
+
+        blocker.Release.set_value();
+    }
+
+    for (auto &task : tasks)
+    {
+        task.Wait();
+    }
+
+    EXPECT_EQ((std::vector<int>{3, 2, 1}), order);
+}
+
+TEST(DeadlineTests, ForScheduling_WhenCoroutineSuspendedOnEvent_NotInherited)
+{
+    using Event = Cortado::AsyncEvent<std::atomic_int64_t>;
+    Event event;
+
+    auto waiter = [](Event &event) -> Task<>
+    {
+        co_await event.WaitAsync();
+    };
+
+    auto task = [&]
+    {
+        Cortado::SchedulingScope scope{WithPriority(99)};
+        return waiter(event);
+    }();
+
+    EXPECT_EQ(0, Cortado::SchedulingTLS::ForScheduling().Priority);
+
+    event.Set();
+    task.Get();
+
+    EXPECT_EQ(0, Cortado::SchedulingTLS::ForScheduling().Priority);
+}
@@ -10,6 +10,9 @@
 
 // STL
 //
+#include <chrono>
+#include <future>
+#include <memory>
 #include <thread>
 
 template <typename T>
@@ -257,3 +260,81 @@ TEST(DefaultTaskTests, WhenAny_WhenTaskThrows_Success)
     EXPECT_TRUE(t.WaitFor(1000))
         << "WhenAny must complete promptly even if a task throws";
 }
+
+TEST(DefaultTaskTests, CoAwait_WhenDeepChainCompletes_NoStackOverflow)
+{
+#if defined(__SANITIZE_ADDRESS__)
+    GTEST_SKIP()
+        << "AddressSanitizer prevents tail calls on symmetric transfer";
+#endif
+
+    // Deep enough to overflow a default stack if every completion resumed
+    // its awaiter recursively.
+    //
+    constexpr int Depth = 500'000;
+
+    Cortado::DefaultEvent ev;
+
+    auto leaf = [](Cortado::DefaultEvent &ev) -> Task<int>
+    {
+        co_await ev.WaitAsync();
+        co_return 0;
+    };
+
+    auto link = [](Task<int> next) -> Task<int>
+    {
+        co_return co_await std::move(next) + 1;
+    };
+
+    // Build the chain iteratively, so that only completion is deep.
+    //
+    Task<int> chain = leaf(ev);
+    for (int i = 0; i < Depth; ++i)
+    {
+        chain = link(std::move(chain));
+    }
+
+    ev.Set();
+
+    EXPECT_EQ(Depth, chain.Get());
+}
+
+TEST(DefaultTaskTests, Destructor_WhenTaskDroppedBeforeCompletion_FrameDestroyed)
+{
+    Cortado::DefaultEvent started;
+    Cortado::DefaultEvent proceed;
+    std::promise<void> destroyed;
+    std::shared_ptr<int> alive{new int{42},
+                               [&destroyed](int *p)
+                               {
+                                   delete p;
+                                   destroyed.set_value();
+                               }};
+    std::weak_ptr<int> observer = alive;
+
+    auto task = [](std::shared_ptr<int> captured,
+                   Cortado::DefaultEvent &started,
+                   Cortado::DefaultEvent &proceed) -> Task<int>
+    {
+        co_await Cortado::ResumeBackground();
+        started.Set();
+        co_await proceed.WaitAsync();
+        co_return *captured;
+    };
+
+    {
+        auto t = task(std::move(alive), started, proceed);
+        started.Wait();
+    }
+
+    EXPECT_FALSE(observer.expired()) << "Coroutine is still running";
+
+    proceed.Set();
+
+    // The coroutine may not have suspended on `proceed` yet, in which case it
+    // completes on the background thread; the frame signals its destruction.
+    //
+    EXPECT_EQ(std::future_status::ready,
+              destroyed.get_future().wait_for(std::chrono::seconds(5)))
+        << "Completed coroutine must destroy a detached frame";
+}
@@ -0,0 +1,103 @@
+/// @file ExpectedTests.cpp
+/// Tests for reporting errors with Cortado::Expected instead of exceptions.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Expected.h>
+
+// STL
+//
+#include <memory>
+#include <string>
+#include <system_error>
+
+namespace
+{
+
+template <typename T>
+using Result = Cortado::Expected<T, std::errc>;
+
+Cortado::Task<Result<int>> Find(int key)
+{
+    if (key < 0)
+    {
+        co_return Cortado::Unexpected{std::errc::invalid_argument};
+    }
+
+    co_return key * 2;
+}
+
+} // namespace
+
+TEST(ExpectedTests, Get_WhenValueReturned_HasValue)
+{
+    auto result = Find(21).Get();
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(42, *result);
+    EXPECT_EQ(42, result.ValueOr(0));
+}
+
+TEST(ExpectedTests, Get_WhenUnexpectedReturned_ErrorWithoutThrow)
+{
+    Result<int> result{0};
+    EXPECT_NO_THROW(result = Find(-1).Get());
+
+    ASSERT_FALSE(result.HasValue());
+    EXPECT_EQ(std::errc::invalid_argument, result.Error());
+    EXPECT_EQ(7, result.ValueOr(7));
+}
+
+TEST(ExpectedTests, CoAwait_WhenChildFails_ParentReceivesError)
+{
+    auto parent = []() -> Cortado::Task<Result<std::string>>
+    {
+        auto found = co_await Find(-1);
+        if (!found)
+        {
+            co_return Cortado::Unexpected{found.Error()};
+        }
+
+        co_return std::to_string(*found);
+    };
+
+    auto result = parent().Get();
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(std::errc::invalid_argument, result.Error());
+}
+
+TEST(ExpectedTests, CoAwait_WhenVoidResult_SuccessOrError)
+{
+    auto check = [](bool ok) -> Cortado::Task<Result<void>>
+    {
+        if (!ok)
+        {
+            co_return Cortado::Unexpected{std::errc::permission_denied};
+        }
+
+        co_return Result<void>{};
+    };
+
+    EXPECT_TRUE(check(true).Get());
+
+    auto failed = check(false).Get();
+    ASSERT_FALSE(failed);
+    EXPECT_EQ(std::errc::permission_denied, failed.Error());
+}
+
+TEST(ExpectedTests, Get_WhenMoveOnlyValue_MovedOut)
+{
+    auto make = []() -> Cortado::Task<Cortado::Expected<std::unique_ptr<int>,
+                                                        std::errc>>
+    { co_return std::make_unique<int>(5); };
+
+    auto result = make().Get();
+
+    ASSERT_TRUE(result);
+    EXPECT_EQ(5, **result);
+}
@@ -0,0 +1,114 @@
+/// @file InvokeTests.cpp
+/// Tests for running callables on a scheduler with Cortado::Invoke.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+
+// STL
+//
+#include <coroutine>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+using PostingScheduler = Cortado::DefaultScheduler;
+
+static_assert(Cortado::Concepts::PostingScheduler<PostingScheduler>);
+
+/// @brief Scheduler which can only resume coroutines.
+///
+class ThreadPerCoroutineScheduler
+{
+public:
+    void Schedule(std::coroutine_handle<> h)
+    {
+        std::thread{[h] { h.resume(); }}.detach();
+    }
+};
+
+static_assert(
+    !Cortado::Concepts::PostingScheduler<ThreadPerCoroutineScheduler>);
+
+int Multiply(int a, int b)
+{
+    return a * b;
+}
+
+} // namespace
+
+TEST(InvokeTests, Invoke_WhenPostingScheduler_ResultReturned)
+{
+    PostingScheduler sched{1};
+
+    auto task = [](PostingScheduler &sched) -> Cortado::Task<int>
+    { co_return co_await Cortado::Invoke(sched, Multiply, 6, 7); };
+
+    EXPECT_EQ(42, task(sched).Get());
+}
+
+TEST(InvokeTests, Invoke_WhenCalled_RunsOnScheduler)
+{
+    PostingScheduler sched{1};
+
+    auto task = [](PostingScheduler &sched) -> Cortado::Task<ThreadIdT>
+    {
+        co_return co_await Cortado::Invoke(
+            sched, [] { return std::this_thread::get_id(); });
+    };
+
+    EXPECT_NE(std::this_thread::get_id(), task(sched).Get());
+}
+
+TEST(InvokeTests, Invoke_WhenSchedulerCannotPost_ResultReturned)
+{
+    ThreadPerCoroutineScheduler sched;
+
+    auto task = [](ThreadPerCoroutineScheduler &sched) -> Cortado::Task<int>
+    {
+        auto owned = std::make_unique<int>(5);
+        co_return co_await Cortado::Invoke(
+            sched,
+            [](std::unique_ptr<int> p) { return *p + 1; },
+            std::move(owned));
+    };
+
+    EXPECT_EQ(6, task(sched).Get());
+}
+
+TEST(InvokeTests, Invoke_WhenCallableThrows_Rethrown)
+{
+    PostingScheduler sched{1};
+
+    auto task = [](PostingScheduler &sched) -> Cortado::Task<>
+    {
+        co_await Cortado::Invoke(sched,
+                                 [] { throw std::runtime_error{"failed"}; });
+    };
+
+    EXPECT_THROW(task(sched).Get(), std::runtime_error);
+}
+
+TEST(InvokeTests, Invoke_WhenVoidCallable_Completes)
+{
+    PostingScheduler sched{1};
+    int calls = 0;
+
+    auto task = [](PostingScheduler &sched, int &calls) -> Cortado::Task<>
+    {
+        co_await Cortado::Invoke(sched, [&calls] { ++calls; });
+        co_await Cortado::Invoke(sched, [&calls] { ++calls; });
+    };
+
+    task(sched, calls).Get();
+
+    EXPECT_EQ(2, calls);
+}
@@ -0,0 +1,138 @@
+/// @file LazyTaskTests.cpp
+/// Tests for Cortado::LazyTask.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/LazyTask.h>
+
+// STL
+//
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+template <typename T = void>
+using LazyTask = Cortado::LazyTask<T>;
+
+template <typename T = void>
+using Task = Cortado::Task<T>;
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+LazyTask<int> CountDown(int n)
+{
+    if (n == 0)
+    {
+        co_return 0;
+    }
+
+    co_return co_await CountDown(n - 1) + 1;
+}
+
+} // namespace
+
+TEST(LazyTaskTests, Create_WhenNotAwaited_NotStarted)
+{
+    bool started = false;
+
+    auto task = [&]() -> LazyTask<int>
+    {
+        started = true;
+        co_return 42;
+    };
+
+    auto t = task();
+
+    EXPECT_FALSE(started);
+    EXPECT_FALSE(t.IsReady());
+
+    EXPECT_EQ(42, t.Get());
+    EXPECT_TRUE(started);
+}
+
+TEST(LazyTaskTests, CoAwait_WhenChildSwitchesThread_Success)
+{
+    auto child = []() -> LazyTask<ThreadIdT>
+    {
+        co_await Cortado::ResumeBackground();
+        co_return std::this_thread::get_id();
+    };
+
+    auto parent = [&]() -> Task<ThreadIdT> { co_return co_await child(); };
+
+    EXPECT_NE(std::this_thread::get_id(), parent().Get());
+}
+
+TEST(LazyTaskTests, CoAwait_WhenLValueAwaitedTwice_StartedOnce)
+{
+    int runs = 0;
+
+    auto child = [&]() -> LazyTask<>
+    {
+        ++runs;
+        co_return;
+    };
+
+    auto parent = [&]() -> Task<>
+    {
+        auto t = child();
+        co_await t;
+        co_await t;
+    };
+
+    parent().Get();
+
+    EXPECT_EQ(1, runs);
+}
+
+TEST(LazyTaskTests, CoAwait_WhenChildThrows_Rethrown)
+{
+    auto child = []() -> LazyTask<int>
+    {
+        co_await Cortado::ResumeBackground();
+        throw std::runtime_error{"Expected"};
+    };
+
+    auto parent = [&]() -> Task<int> { co_return co_await child(); };
+
+    EXPECT_THROW(parent().Get(), std::runtime_error);
+}
+
+TEST(LazyTaskTests, Destructor_WhenNeverStarted_FrameDestroyed)
+{
+    auto alive = std::make_shared<int>(42);
+    std::weak_ptr<int> observer = alive;
+
+    auto task = [](std::shared_ptr<int> captured) -> LazyTask<int>
+    {
+        co_return *captured;
+    };
+
+    {
+        auto t = task(std::move(alive));
+        EXPECT_FALSE(observer.expired());
+    }
+
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST(LazyTaskTests, CoAwait_WhenDeepRecursion_NoStackOverflow)
+{
+#if defined(__SANITIZE_ADDRESS__)
+    GTEST_SKIP()
+        << "AddressSanitizer prevents tail calls on symmetric transfer";
+#endif
+
+    // Both start and completion of every level are symmetric transfers.
+    //
+    constexpr int Depth = 500'000;
+
+    EXPECT_EQ(Depth, CountDown(Depth).Get());
+}
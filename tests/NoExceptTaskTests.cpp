@@ -0,0 +1,127 @@
+/// @file NoExceptTaskTests.cpp
+/// Tests for Cortado::NoExceptTaskImpl. Built with exceptions disabled.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Detail/Throw.h>
+#include <Cortado/Expected.h>
+#include <Cortado/NoExceptTaskImpl.h>
+#include <Cortado/Sender.h>
+
+// STL
+//
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+
+template <typename T = void>
+using Task = Cortado::Task<T, Cortado::NoExceptTaskImpl>;
+
+using NoException = Cortado::Common::NoExceptHandler::Exception;
+
+static_assert(Cortado::Concepts::TaskImpl<Cortado::NoExceptTaskImpl>);
+static_assert(Cortado::Concepts::NoExcept<Cortado::NoExceptTaskImpl>);
+static_assert(!Cortado::Concepts::NoExcept<Cortado::DefaultTaskImpl>);
+static_assert(sizeof(Cortado::Detail::CoroutineStorage<int, NoException>) <
+                  sizeof(Cortado::Detail::CoroutineStorage<int,
+                                                           std::exception_ptr>),
+              "NoExcept tasks must not reserve space for an exception");
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+Task<ThreadIdT> GetBackgroundThreadId()
+{
+    co_await Cortado::ResumeBackground();
+    co_return std::this_thread::get_id();
+}
+
+/// @brief Receiver which publishes the value through an atomic.
+///
+struct AtomicReceiver
+{
+    void set_value(int value) noexcept
+    {
+        Result->store(value);
+        Result->notify_one();
+    }
+
+    void set_error(std::exception_ptr) noexcept
+    {
+        std::terminate();
+    }
+
+    void set_stopped() noexcept
+    {
+        std::terminate();
+    }
+
+    std::atomic_int *Result;
+};
+
+} // namespace
+
+TEST(NoExceptTaskTests, Get_WhenCompletedSynchronously_Success)
+{
+    auto task = []() -> Task<int> { co_return 42; };
+
+    EXPECT_EQ(42, task().Get());
+}
+
+TEST(NoExceptTaskTests, CoAwait_WhenChildOnBackgroundThread_Success)
+{
+    auto parent = []() -> Task<ThreadIdT>
+    {
+        co_return co_await GetBackgroundThreadId();
+    };
+
+    EXPECT_NE(std::this_thread::get_id(), parent().Get());
+}
+
+TEST(NoExceptTaskTests, Get_WhenExpectedError_ReturnedAsValue)
+{
+    auto task = []() -> Task<Cortado::Expected<int, std::errc>>
+    { co_return Cortado::Unexpected{std::errc::timed_out}; };
+
+    auto result = task().Get();
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(std::errc::timed_out, result.Error());
+}
+
+TEST(NoExceptTaskTests, Get_WhenErrorEscapes_Terminates)
+{
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+
+    auto task = []() -> Task<int>
+    {
+        Cortado::Detail::Throw(std::runtime_error{"escaped"});
+        co_return 0;
+    };
+
+    EXPECT_DEATH(task().Get(), "");
+}
+
+TEST(NoExceptTaskTests, AsSender_WhenTaskCompletes_ReceivesValue)
+{
+    auto task = []() -> Task<int>
+    {
+        co_await Cortado::ResumeBackground();
+        co_return 42;
+    };
+
+    std::atomic_int result{0};
+    auto op = Cortado::AsSender(task()).connect(AtomicReceiver{&result});
+    op.start();
+
+    result.wait(0);
+    EXPECT_EQ(42, result.load());
+}
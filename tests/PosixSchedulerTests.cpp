@@ -0,0 +1,134 @@
+/// @file PosixSchedulerTests.cpp
+/// Tests for Cortado::Common::PosixCoroutineScheduler options.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Common/PosixCoroutineScheduler.h>
+
+#ifdef _POSIX_VERSION
+
+// STL
+//
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <system_error>
+#include <thread>
+
+using Cortado::Common::PosixCoroutineScheduler;
+using Cortado::Common::PosixCoroutineSchedulerOptions;
+
+#ifdef __GLIBC__
+
+TEST(PosixSchedulerTests, Options_WhenStackSizeSet_WorkersUseIt)
+{
+    constexpr std::size_t StackSize = 256 * 1024;
+
+    PosixCoroutineScheduler sched{PosixCoroutineSchedulerOptions{
+        .NumThreads = 1, .StackSize = StackSize, .GuardSize = 4096}};
+
+    std::promise<std::pair<std::size_t, std::size_t>> sizes;
+    sched.Post(
+        [&]
+        {
+            pthread_attr_t attr;
+            pthread_getattr_np(pthread_self(), &attr);
+
+            std::size_t stackSize = 0;
+            std::size_t guardSize = 0;
+            pthread_attr_getstacksize(&attr, &stackSize);
+            pthread_attr_getguardsize(&attr, &guardSize);
+            pthread_attr_destroy(&attr);
+
+            sizes.set_value({stackSize, guardSize});
+        });
+
+    auto [stackSize, guardSize] = sizes.get_future().get();
+    EXPECT_EQ(StackSize, stackSize);
+    EXPECT_EQ(4096u, guardSize);
+}
+
+TEST(PosixSchedulerTests, Options_WhenWorkerCannotStart_Throws)
+{
+    // Larger than the user address space, so the stack cannot be mapped.
+    //
+    PosixCoroutineSchedulerOptions options{
+        .NumThreads = 2,
+        .StackSize = std::size_t{1} << 50};
+
+    EXPECT_THROW(PosixCoroutineScheduler{options}, std::system_error);
+}
+
+#endif // __GLIBC__
+
+TEST(PosixSchedulerTests, Options_WhenIdleDelaySet_HookCalledOncePerQuietPeriod)
+{
+    std::atomic_int idleCount{0};
+
+    PosixCoroutineScheduler sched{PosixCoroutineSchedulerOptions{
+        .NumThreads = 4,
+        .IdleDelay = std::chrono::milliseconds{10},
+        .OnIdle = [&] { ++idleCount; }}};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    EXPECT_EQ(1, idleCount.load());
+
+    std::promise<void> done;
+    sched.Post([&] { done.set_value(); });
+    done.get_future().get();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    EXPECT_EQ(2, idleCount.load());
+}
+
+TEST(PosixSchedulerTests, Options_WhenOtherWorkerBusy_HookNotCalled)
+{
+    std::atomic_int idleCount{0};
+
+    PosixCoroutineScheduler sched{PosixCoroutineSchedulerOptions{
+        .NumThreads = 2,
+        .IdleDelay = std::chrono::milliseconds{10},
+        .OnIdle = [&] { ++idleCount; }}};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    ASSERT_EQ(1, idleCount.load());
+
+    std::promise<void> release;
+    std::promise<void> done;
+    sched.Post(
+        [&, released = release.get_future()]
+        {
+            released.wait();
+            done.set_value();
+        });
+
+    // The queue is empty, but the pool is not without work.
+    //
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    EXPECT_EQ(1, idleCount.load());
+
+    release.set_value();
+    done.get_future().get();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    EXPECT_EQ(2, idleCount.load());
+}
+
+TEST(PosixSchedulerTests, Options_WhenIdleDelayZero_HookNotCalled)
+{
+    std::atomic_int idleCount{0};
+
+    {
+        PosixCoroutineScheduler sched{PosixCoroutineSchedulerOptions{
+            .NumThreads = 2, .OnIdle = [&] { ++idleCount; }}};
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{30});
+    }
+
+    EXPECT_EQ(0, idleCount.load());
+}
+
+#endif // _POSIX_VERSION
@@ -0,0 +1,143 @@
+/// @file PostedWorkTests.cpp
+/// Tests for posting plain callables to schedulers.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Common/WeightedFairCoroutineScheduler.h>
+#include <Cortado/DefaultScheduler.h>
+
+// STL
+//
+#include <array>
+#include <future>
+#include <memory>
+#include <thread>
+
+namespace
+{
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+using Cortado::Detail::PostedWork;
+
+static_assert(PostedWork::FitsInline<void (*)()>);
+static_assert(PostedWork::FitsInline<std::array<void *, 4>>);
+static_assert(!PostedWork::FitsInline<std::array<char, 128>>);
+
+static_assert(Cortado::Concepts::PostingScheduler<Cortado::DefaultScheduler>);
+static_assert(Cortado::Concepts::PostingScheduler<
+              Cortado::Common::WeightedFairCoroutineScheduler>);
+
+/// @brief Counts destructor calls of live copies.
+///
+struct DestructionCounter
+{
+    explicit DestructionCounter(int &count) : Count{&count}
+    {
+    }
+
+    DestructionCounter(DestructionCounter &&other) noexcept :
+        Count{std::exchange(other.Count, nullptr)}
+    {
+    }
+
+    ~DestructionCounter()
+    {
+        if (Count != nullptr)
+        {
+            ++*Count;
+        }
+    }
+
+    int *Count;
+};
+
+} // namespace
+
+TEST(PostedWorkTests, Post_WhenDefaultScheduler_RunsOnOtherThread)
+{
+    std::promise<ThreadIdT> threadId;
+
+    Cortado::DefaultScheduler::GetDefaultBackgroundScheduler().Post(
+        [&] { threadId.set_value(std::this_thread::get_id()); });
+
+    EXPECT_NE(std::this_thread::get_id(), threadId.get_future().get());
+}
+
+TEST(PostedWorkTests, Post_WhenLargeCapture_Runs)
+{
+    std::array<int, 64> data{};
+    data.back() = 42;
+    std::promise<int> result;
+
+    Cortado::DefaultScheduler::GetDefaultBackgroundScheduler().Post(
+        [data, &result] { result.set_value(data.back()); });
+
+    EXPECT_EQ(42, result.get_future().get());
+}
+
+TEST(PostedWorkTests, Post_WhenMoveOnlyCapture_Runs)
+{
+    auto value = std::make_unique<int>(42);
+    std::promise<int> result;
+
+    Cortado::DefaultScheduler::GetDefaultBackgroundScheduler().Post(
+        [value = std::move(value), &result] { result.set_value(*value); });
+
+    EXPECT_EQ(42, result.get_future().get());
+}
+
+TEST(PostedWorkTests, Post_WhenWeightedFairScheduler_RunsOnBehalfOfTenant)
+{
+    Cortado::Common::WeightedFairCoroutineScheduler sched{1};
+    std::promise<Cortado::Common::TenantId> tenant;
+
+    sched.Post([&] { tenant.set_value(Cortado::Common::TenantTLS::Get()); },
+               7);
+
+    // Posted callables run on behalf of the queue they were taken from.
+    //
+    EXPECT_EQ(7u, tenant.get_future().get());
+}
+
+TEST(PostedWorkTests, Invoke_WhenInline_DestroyedOnce)
+{
+    int destroyed = 0;
+    int invoked = 0;
+
+    {
+        PostedWork work{[counter = DestructionCounter{destroyed}, &invoked]
+                        { ++invoked; }};
+        PostedWork moved{std::move(work)};
+
+        EXPECT_FALSE(work);
+        EXPECT_TRUE(moved);
+
+        moved();
+
+        EXPECT_FALSE(moved);
+        EXPECT_EQ(1, destroyed);
+    }
+
+    EXPECT_EQ(1, invoked);
+    EXPECT_EQ(1, destroyed);
+}
+
+TEST(PostedWorkTests, Destructor_WhenNotInvoked_DestroysCallable)
+{
+    int destroyed = 0;
+    int invoked = 0;
+
+    {
+        std::array<char, 128> padding{};
+        PostedWork work{[counter = DestructionCounter{destroyed},
+                         padding,
+                         &invoked] { ++invoked; }};
+    }
+
+    EXPECT_EQ(0, invoked);
+    EXPECT_EQ(1, destroyed);
+}
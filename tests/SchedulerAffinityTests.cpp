@@ -0,0 +1,228 @@
+/// @file SchedulerAffinityTests.cpp
+/// Tests for resuming awaiting coroutines on their original scheduler.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Common/OriginalSchedulerAffinity.h>
+
+// STL
+//
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+/// @brief Single-threaded scheduler which counts scheduled coroutines.
+///
+class CountingScheduler
+{
+public:
+    CountingScheduler() : m_thread{[this] { Run(); }}
+    {
+    }
+
+    ~CountingScheduler()
+    {
+        {
+            std::lock_guard lk{m_mutex};
+            m_stop = true;
+        }
+        m_cv.notify_one();
+        m_thread.join();
+    }
+
+    void Schedule(std::coroutine_handle<> h)
+    {
+        ++ScheduleCount;
+        {
+            std::lock_guard lk{m_mutex};
+            m_queue.push_back(h);
+        }
+        m_cv.notify_one();
+    }
+
+    ThreadIdT GetThreadId() const
+    {
+        return m_thread.get_id();
+    }
+
+    std::atomic_int ScheduleCount{0};
+
+private:
+    void Run()
+    {
+        Cortado::CurrentSchedulerScope currentScheduler{*this};
+
+        for (;;)
+        {
+            std::coroutine_handle<> h;
+            {
+                std::unique_lock lk{m_mutex};
+                m_cv.wait(lk, [this] { return m_stop || !m_queue.empty(); });
+                if (m_queue.empty())
+                {
+                    return;
+                }
+
+                h = m_queue.front();
+                m_queue.pop_front();
+            }
+            h();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::coroutine_handle<>> m_queue;
+    bool m_stop = false;
+    std::thread m_thread;
+};
+
+struct AffinityTaskImpl :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::OriginalSchedulerAffinity
+{
+};
+
+static_assert(Cortado::Concepts::SchedulerAffinity<AffinityTaskImpl>);
+static_assert(!Cortado::Concepts::SchedulerAffinity<Cortado::DefaultTaskImpl>);
+
+template <typename T = void, typename TaskImplT = AffinityTaskImpl>
+using Task = Cortado::Task<T, TaskImplT>;
+
+template <typename TaskImplT>
+Task<void, TaskImplT> RunOnOtherPool(CountingScheduler &pool)
+{
+    using Cortado::operator co_await;
+    co_await pool;
+
+    // Make sure parent is suspended by the time we complete.
+    //
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+
+template <typename TaskImplT>
+Task<ThreadIdT, TaskImplT> AwaitChildOnOtherPool(CountingScheduler &cpu,
+                                                 CountingScheduler &blocking)
+{
+    using Cortado::operator co_await;
+    co_await cpu;
+
+    co_await RunOnOtherPool<TaskImplT>(blocking);
+
+    co_return std::this_thread::get_id();
+}
+
+} // namespace
+
+TEST(SchedulerAffinityTests, CoAwait_WhenChildCompletesOnOtherPool_Rescheduled)
+{
+    CountingScheduler cpu;
+    CountingScheduler blocking;
+
+    auto threadId =
+        AwaitChildOnOtherPool<AffinityTaskImpl>(cpu, blocking).Get();
+
+    EXPECT_EQ(cpu.GetThreadId(), threadId);
+    EXPECT_EQ(2, cpu.ScheduleCount.load())
+        << "Continuation must be rescheduled on the original pool";
+}
+
+TEST(SchedulerAffinityTests, CoAwait_WhenNoAffinity_StaysOnChildPool)
+{
+    CountingScheduler cpu;
+    CountingScheduler blocking;
+
+    auto threadId =
+        AwaitChildOnOtherPool<Cortado::DefaultTaskImpl>(cpu, blocking).Get();
+
+    EXPECT_EQ(blocking.GetThreadId(), threadId);
+    EXPECT_EQ(1, cpu.ScheduleCount.load());
+}
+
+TEST(SchedulerAffinityTests, CoAwait_WhenChildCompletesOnSamePool_NotRescheduled)
+{
+    CountingScheduler cpu;
+
+    auto threadId = AwaitChildOnOtherPool<AffinityTaskImpl>(cpu, cpu).Get();
+
+    EXPECT_EQ(cpu.GetThreadId(), threadId);
+    EXPECT_EQ(2, cpu.ScheduleCount.load())
+        << "Only the two explicit hops are expected";
+}
+
+TEST(SchedulerAffinityTests, CurrentScheduler_WhenOnWorker_Published)
+{
+    CountingScheduler cpu;
+
+    EXPECT_FALSE(Cortado::CurrentScheduler::Get());
+
+    auto task = [](CountingScheduler &cpu) -> Task<bool>
+    {
+        using Cortado::operator co_await;
+        co_await cpu;
+        co_return Cortado::CurrentScheduler::Get() ==
+            Cortado::SchedulerRef{cpu};
+    };
+
+    EXPECT_TRUE(task(cpu).Get());
+}
+
+TEST(SchedulerAffinityTests, CoAwait_WhenDeepChainCompletesOnSamePool_NoStackOverflow)
+{
+#if defined(__SANITIZE_ADDRESS__)
+    GTEST_SKIP()
+        << "AddressSanitizer prevents tail calls on symmetric transfer";
+#endif
+
+    // Deep enough to overflow a worker stack if every completion resumed
+    // its awaiter in place.
+    //
+    constexpr int Depth = 200'000;
+
+    CountingScheduler cpu;
+
+    auto leaf = [](Cortado::DefaultEvent &ev) -> Task<int>
+    {
+        co_await ev.WaitAsync();
+        co_return 0;
+    };
+
+    auto link = [](Task<int> next) -> Task<int>
+    {
+        co_return co_await std::move(next) + 1;
+    };
+
+    auto run = [&](CountingScheduler &cpu) -> Task<int>
+    {
+        using Cortado::operator co_await;
+        co_await cpu;
+
+        // Every link is suspended on the worker, so that completion on the
+        // same worker continues in place.
+        //
+        Cortado::DefaultEvent ev;
+        Task<int> chain = leaf(ev);
+        for (int i = 0; i < Depth; ++i)
+        {
+            chain = link(std::move(chain));
+        }
+
+        ev.Set();
+
+        co_return co_await std::move(chain);
+    };
+
+    EXPECT_EQ(Depth, run(cpu).Get());
+    EXPECT_EQ(1, cpu.ScheduleCount.load());
+}
@@ -0,0 +1,80 @@
+/// @file SchedulerRegistryTests.cpp
+/// Tests for Cortado::SchedulerRegistry.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Common/WeightedFairCoroutineScheduler.h>
+#include <Cortado/SchedulerRegistry.h>
+
+// STL
+//
+#include <array>
+#include <thread>
+
+template <typename T = void>
+using Task = Cortado::Task<T>;
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+using Pool = Cortado::Common::WeightedFairCoroutineScheduler;
+
+TEST(SchedulerRegistryTests, OnPool_WhenMovingBetweenPools_Success)
+{
+    Cortado::SchedulerRegistry registry;
+    registry.Emplace<Pool>("io", 1);
+    registry.Emplace<Pool>("latency", 1);
+
+    auto task = [&]() -> Task<std::array<ThreadIdT, 3>>
+    {
+        std::array<ThreadIdT, 3> ids;
+
+        co_await Cortado::OnPool("io", registry);
+        ids[0] = std::this_thread::get_id();
+
+        co_await Cortado::OnPool("latency", registry);
+        ids[1] = std::this_thread::get_id();
+
+        co_await Cortado::OnPool("io", registry);
+        ids[2] = std::this_thread::get_id();
+
+        co_return ids;
+    };
+
+    auto ids = task().Get();
+
+    EXPECT_NE(std::this_thread::get_id(), ids[0]);
+    EXPECT_NE(ids[0], ids[1]) << "Pools must not share threads";
+    EXPECT_EQ(ids[0], ids[2]) << "Single-threaded pool must be reused";
+}
+
+TEST(SchedulerRegistryTests, Register_WhenExternalPool_Success)
+{
+    Pool pool{1};
+
+    Cortado::SchedulerRegistry registry;
+    registry.Register("cpu", pool);
+
+    EXPECT_TRUE(registry.Find("cpu") == Cortado::SchedulerRef{pool});
+    EXPECT_FALSE(registry.Find("gpu"));
+
+    auto task = [](Cortado::SchedulerRef cpu) -> Task<ThreadIdT>
+    {
+        co_await Cortado::OnPool(cpu);
+        co_return std::this_thread::get_id();
+    };
+
+    EXPECT_NE(std::this_thread::get_id(), task(registry.Get("cpu")).Get());
+}
+
+TEST(SchedulerRegistryTests, Get_WhenUnknownPool_Throws)
+{
+    Cortado::SchedulerRegistry registry;
+    registry.Emplace<Pool>("io", 1);
+
+    EXPECT_THROW(registry.Get("latency"), std::out_of_range);
+    EXPECT_THROW(registry.Emplace<Pool>("io", 1), std::invalid_argument);
+}
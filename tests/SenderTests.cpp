@@ -0,0 +1,249 @@
+/// @file SenderTests.cpp
+/// Tests for sender/receiver interoperability.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Sender.h>
+
+// STL
+//
+#include <future>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+
+using ThreadIdT = decltype(std::this_thread::get_id());
+
+template <typename T = void>
+using Task = Cortado::Task<T>;
+
+/// @brief Scheduler which only accepts coroutine handles.
+///
+struct HandleOnlyScheduler
+{
+    void Schedule(std::coroutine_handle<> h)
+    {
+        std::thread{[h] { h.resume(); }}.detach();
+    }
+};
+
+static_assert(!Cortado::Concepts::PostingScheduler<HandleOnlyScheduler>);
+
+/// @brief Receiver which forwards the result to a std::promise.
+///
+template <typename V>
+struct PromiseReceiver
+{
+    template <typename... Args>
+    void set_value(Args &&...args) noexcept
+    {
+        Result->set_value(std::forward<Args>(args)...);
+    }
+
+    void set_error(std::exception_ptr e) noexcept
+    {
+        Result->set_exception(std::move(e));
+    }
+
+    void set_stopped() noexcept
+    {
+        Result->set_exception(
+            std::make_exception_ptr(Cortado::OperationStopped{}));
+    }
+
+    std::promise<V> *Result;
+};
+
+/// @brief Sender which completes inline with a stop signal.
+///
+struct StoppedSender
+{
+    using value_type = int;
+
+    template <typename ReceiverT>
+    struct Operation
+    {
+        void start() noexcept
+        {
+            std::move(Receiver).set_stopped();
+        }
+
+        ReceiverT Receiver;
+    };
+
+    template <typename ReceiverT>
+    Operation<std::remove_cvref_t<ReceiverT>> connect(ReceiverT &&r) &&
+    {
+        return {std::forward<ReceiverT>(r)};
+    }
+};
+
+/// @brief Error handler which stores error codes instead of exceptions.
+///
+struct ErrorCodeHandler
+{
+    using Exception = std::error_code;
+
+    static std::error_code Catch()
+    {
+        try
+        {
+            throw;
+        }
+        catch (const std::system_error &e)
+        {
+            return e.code();
+        }
+    }
+
+    static void Rethrow(std::error_code e)
+    {
+        throw std::system_error{e};
+    }
+};
+
+struct ErrorCodeTaskImpl :
+    Cortado::Common::STLAtomic,
+    Cortado::Common::STLCoroutineAllocator,
+    ErrorCodeHandler,
+    Cortado::DefaultScheduler
+{
+    using Event = Cortado::DefaultEvent;
+};
+
+static_assert(Cortado::Concepts::TaskImpl<ErrorCodeTaskImpl>);
+
+static_assert(Cortado::Concepts::Sender<StoppedSender>);
+static_assert(Cortado::Concepts::Sender<
+              decltype(Cortado::Schedule(std::declval<HandleOnlyScheduler &>()))>);
+static_assert(!Cortado::Concepts::Sender<Task<int>>);
+
+} // namespace
+
+TEST(SenderTests, CoAwaitSchedule_WhenPostingScheduler_ResumesOnScheduler)
+{
+    auto task = []() -> Task<ThreadIdT>
+    {
+        co_await Cortado::Schedule(
+            Cortado::DefaultScheduler::GetDefaultBackgroundScheduler());
+        co_return std::this_thread::get_id();
+    };
+
+    EXPECT_NE(std::this_thread::get_id(), task().Get());
+}
+
+TEST(SenderTests, CoAwaitSchedule_WhenHandleOnlyScheduler_ResumesOnScheduler)
+{
+    HandleOnlyScheduler sched;
+
+    auto task = [](HandleOnlyScheduler &sched) -> Task<ThreadIdT>
+    {
+        co_await Cortado::Schedule(sched);
+        co_return std::this_thread::get_id();
+    };
+
+    EXPECT_NE(std::this_thread::get_id(), task(sched).Get());
+}
+
+TEST(SenderTests, CoAwaitSender_WhenStopped_Throws)
+{
+    auto task = []() -> Task<int> { co_return co_await StoppedSender{}; };
+
+    EXPECT_THROW(task().Get(), Cortado::OperationStopped);
+}
+
+TEST(SenderTests, AsSender_WhenTaskCompletesLater_ReceivesValue)
+{
+    auto task = []() -> Task<int>
+    {
+        co_await Cortado::ResumeBackground();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        co_return 42;
+    };
+
+    std::promise<int> result;
+    auto op = Cortado::AsSender(task()).connect(PromiseReceiver<int>{&result});
+    op.start();
+
+    EXPECT_EQ(42, result.get_future().get());
+}
+
+TEST(SenderTests, AsSender_WhenTaskAlreadyCompleted_ReceivesValueInline)
+{
+    auto task = []() -> Task<int> { co_return 42; };
+
+    std::promise<int> result;
+    auto future = result.get_future();
+    auto op = Cortado::AsSender(task()).connect(PromiseReceiver<int>{&result});
+    op.start();
+
+    ASSERT_EQ(std::future_status::ready,
+              future.wait_for(std::chrono::seconds(0)));
+    EXPECT_EQ(42, future.get());
+}
+
+TEST(SenderTests, AsSender_WhenTaskThrows_ReceivesError)
+{
+    auto task = []() -> Task<>
+    {
+        co_await Cortado::ResumeBackground();
+        throw std::runtime_error{"Expected"};
+    };
+
+    std::promise<void> result;
+    auto op = Cortado::AsSender(task()).connect(PromiseReceiver<void>{&result});
+    op.start();
+
+    EXPECT_THROW(result.get_future().get(), std::runtime_error);
+}
+
+TEST(SenderTests, AsSender_WhenCustomErrorHandler_ReceivesWrappedError)
+{
+    auto task = []() -> Cortado::Task<void, ErrorCodeTaskImpl>
+    {
+        co_await Cortado::ResumeBackground();
+        throw std::system_error{
+            std::make_error_code(std::errc::timed_out)};
+    };
+
+    std::promise<void> result;
+    auto op = Cortado::AsSender(task()).connect(PromiseReceiver<void>{&result});
+    op.start();
+
+    try
+    {
+        result.get_future().get();
+        FAIL() << "Expected an error";
+    }
+    catch (const std::error_code &e)
+    {
+        EXPECT_EQ(std::make_error_code(std::errc::timed_out), e);
+    }
+}
+
+TEST(SenderTests, CoAwaitAsSender_WhenMixedPipeline_Success)
+{
+    auto child = []() -> Task<int>
+    {
+        co_await Cortado::ResumeBackground();
+        co_return 21;
+    };
+
+    auto parent = [&]() -> Task<int>
+    {
+        int value = co_await Cortado::AsSender(child());
+        co_await Cortado::Schedule(
+            Cortado::DefaultScheduler::GetDefaultBackgroundScheduler());
+        co_return value * 2;
+    };
+
+    EXPECT_EQ(42, parent().Get());
+}
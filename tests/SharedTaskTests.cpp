@@ -0,0 +1,175 @@
+/// @file SharedTaskTests.cpp
+/// Tests for Cortado::SharedTask.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/SharedTask.h>
+
+// STL
+//
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+template <typename T = void>
+using SharedTask = Cortado::SharedTask<T>;
+
+template <typename T = void>
+using Task = Cortado::Task<T>;
+
+SharedTask<std::string> Fill(Cortado::DefaultEvent &ready)
+{
+    co_await ready.WaitAsync();
+    co_return "cached";
+}
+
+Task<const std::string *> Read(SharedTask<std::string> fill)
+{
+    const std::string &value = co_await fill;
+    co_return &value;
+}
+
+} // namespace
+
+TEST(SharedTaskTests, CoAwait_WhenManyAwaitersInFlight_AllResumedWithSameResult)
+{
+    constexpr std::size_t AwaiterCount = 500;
+
+    Cortado::DefaultEvent ready;
+    auto fill = Fill(ready);
+
+    std::vector<Task<const std::string *>> readers;
+    for (std::size_t i = 0; i < AwaiterCount; ++i)
+    {
+        readers.push_back(Read(fill));
+    }
+
+    EXPECT_FALSE(fill.IsReady());
+
+    ready.Set();
+
+    for (auto &reader : readers)
+    {
+        const std::string *value = reader.Get();
+        EXPECT_EQ("cached", *value);
+        EXPECT_EQ(&fill.Get(), value) << "Result must not be copied";
+    }
+}
+
+TEST(SharedTaskTests, CoAwait_WhenAwaitersOnManyThreads_AllResumed)
+{
+    constexpr int AwaiterCount = 200;
+
+    Cortado::DefaultEvent ready;
+    std::atomic_int resumed{0};
+
+    auto source = [](Cortado::DefaultEvent &ready) -> SharedTask<int>
+    {
+        co_await Cortado::ResumeBackground();
+        co_await ready.WaitAsync();
+        co_return 42;
+    };
+
+    auto reader = [](SharedTask<int> task, std::atomic_int &resumed) -> Task<>
+    {
+        co_await Cortado::ResumeBackground();
+        EXPECT_EQ(42, co_await task);
+        ++resumed;
+    };
+
+    auto shared = source(ready);
+
+    std::vector<Task<>> readers;
+    for (int i = 0; i < AwaiterCount; ++i)
+    {
+        readers.push_back(reader(shared, resumed));
+    }
+
+    ready.Set();
+
+    for (auto &r : readers)
+    {
+        r.Get();
+    }
+
+    EXPECT_EQ(AwaiterCount, resumed.load());
+}
+
+TEST(SharedTaskTests, CoAwait_WhenThrows_EveryAwaiterRethrows)
+{
+    Cortado::DefaultEvent ready;
+
+    auto source = [](Cortado::DefaultEvent &ready) -> SharedTask<int>
+    {
+        co_await ready.WaitAsync();
+        throw std::runtime_error{"Expected"};
+    };
+
+    auto reader = [](SharedTask<int> task) -> Task<int>
+    {
+        co_return co_await task;
+    };
+
+    auto shared = source(ready);
+    auto r1 = reader(shared);
+    auto r2 = reader(shared);
+
+    ready.Set();
+
+    EXPECT_THROW(r1.Get(), std::runtime_error);
+    EXPECT_THROW(r2.Get(), std::runtime_error);
+    EXPECT_THROW(shared.Get(), std::runtime_error);
+}
+
+TEST(SharedTaskTests, Destructor_WhenLastCopyDropped_FrameDestroyed)
+{
+    auto alive = std::make_shared<int>(42);
+    std::weak_ptr<int> observer = alive;
+
+    auto task = [](std::shared_ptr<int> captured) -> SharedTask<int>
+    {
+        co_return *captured;
+    };
+
+    {
+        auto t1 = task(std::move(alive));
+        auto t2 = t1;
+
+        {
+            auto t3 = std::move(t1);
+            EXPECT_EQ(42, t3.Get());
+        }
+
+        EXPECT_FALSE(observer.expired());
+        EXPECT_EQ(42, t2.Get());
+    }
+
+    EXPECT_TRUE(observer.expired());
+}
+
+TEST(SharedTaskTests, Get_WhenVoid_RunsOnce)
+{
+    std::atomic_int runs{0};
+
+    auto task = [](std::atomic_int &runs) -> SharedTask<>
+    {
+        co_await Cortado::ResumeBackground();
+        ++runs;
+    };
+
+    auto t1 = task(runs);
+    auto t2 = t1;
+
+    t1.Get();
+    t2.Get();
+
+    EXPECT_EQ(1, runs.load());
+}
@@ -0,0 +1,117 @@
+/// @file SingleThreadedTaskTests.cpp
+/// Tests for Cortado::SingleThreadedTaskImpl.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/AsyncEvent.h>
+#include <Cortado/Await.h>
+#include <Cortado/SingleThreadedTaskImpl.h>
+
+// STL
+//
+#include <stdexcept>
+
+namespace
+{
+
+template <typename T = void>
+using Task = Cortado::Task<T, Cortado::SingleThreadedTaskImpl>;
+
+using Event = Cortado::AsyncEvent<Cortado::Common::NonAtomic>;
+
+static_assert(Cortado::Concepts::Atomic<Cortado::Common::NonAtomic>);
+static_assert(Cortado::Concepts::TaskImpl<Cortado::SingleThreadedTaskImpl>);
+static_assert(
+    !Cortado::Concepts::BackgroundResumable<Cortado::SingleThreadedTaskImpl>);
+
+Task<int> WaitForEvent(Event &event, int value)
+{
+    co_await event.WaitAsync();
+    co_return value;
+}
+
+} // namespace
+
+TEST(SingleThreadedTaskTests, NonAtomic_CompareExchange_Success)
+{
+    Cortado::Common::NonAtomic value{1};
+
+    Cortado::Concepts::AtomicPrimitive expected = 2;
+    EXPECT_FALSE(value.compare_exchange_strong(
+        expected, 3, std::memory_order::relaxed, std::memory_order::relaxed));
+    EXPECT_EQ(1, expected);
+
+    EXPECT_TRUE(value.compare_exchange_weak(
+        expected, 3, std::memory_order::relaxed, std::memory_order::relaxed));
+    EXPECT_EQ(3, value.load(std::memory_order::relaxed));
+
+    EXPECT_EQ(4, ++value);
+    EXPECT_EQ(3, --value);
+    EXPECT_EQ(3, value.exchange(5, std::memory_order::relaxed));
+    EXPECT_EQ(5, value.load(std::memory_order::relaxed));
+}
+
+TEST(SingleThreadedTaskTests, Get_WhenCompletedSynchronously_Success)
+{
+    auto task = []() -> Task<int> { co_return 42; };
+
+    EXPECT_EQ(42, task().Get());
+}
+
+TEST(SingleThreadedTaskTests, CoAwait_WhenResumedBySameThread_Success)
+{
+    Event event;
+
+    auto parent = [](Event &event) -> Task<int>
+    {
+        co_return co_await WaitForEvent(event, 41) + 1;
+    };
+
+    auto t = parent(event);
+
+    EXPECT_FALSE(t.IsReady());
+    EXPECT_FALSE(t.WaitFor(0));
+
+    event.Set();
+
+    EXPECT_TRUE(t.IsReady());
+    EXPECT_EQ(42, t.Get());
+}
+
+TEST(SingleThreadedTaskTests, CoAwait_WhenChildThrows_Rethrown)
+{
+    Event event;
+
+    auto child = [](Event &event) -> Task<>
+    {
+        co_await event.WaitAsync();
+        throw std::runtime_error{"Expected"};
+    };
+
+    auto parent = [&]() -> Task<> { co_await child(event); };
+
+    auto t = parent();
+    event.Set();
+
+    EXPECT_THROW(t.Get(), std::runtime_error);
+}
+
+TEST(SingleThreadedTaskTests, Destructor_WhenDroppedBeforeCompletion_Success)
+{
+    Event event;
+    bool completed = false;
+
+    auto task = [](Event &event, bool &completed) -> Task<>
+    {
+        co_await event.WaitAsync();
+        completed = true;
+    };
+
+    task(event, completed);
+    event.Set();
+
+    EXPECT_TRUE(completed);
+}
@@ -0,0 +1,116 @@
+/// @file TaskContextTests.cpp
+/// Tests for task-local context slots and their propagation.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Common/TaskContextPropagation.h>
+
+// STL
+//
+#include <string>
+#include <utility>
+
+namespace
+{
+
+struct TaskImplWithContext :
+    Cortado::DefaultTaskImpl,
+    Cortado::Common::TaskContextPreAndPostActions
+{
+};
+
+template <typename T = void>
+using Task = Cortado::Task<T, TaskImplWithContext>;
+
+const Cortado::ContextSlot<std::string> TraceSlot;
+const Cortado::ContextSlot<int> PrioritySlot;
+
+Task<std::string> ReadTraceInBackground()
+{
+    co_await Cortado::ResumeBackground();
+
+    const std::string *trace = TraceSlot.Get();
+    co_return trace != nullptr ? *trace : std::string{};
+}
+
+} // namespace
+
+TEST(TaskContextTests, Get_WhenSlotNotSet_Nullptr)
+{
+    EXPECT_EQ(nullptr, TraceSlot.Get());
+    EXPECT_EQ(nullptr, Cortado::TaskContext{}.Get(PrioritySlot));
+}
+
+TEST(TaskContextTests, With_WhenSlotOverridden_OriginalUnchanged)
+{
+    auto parent = Cortado::TaskContext{}.With(TraceSlot, "parent");
+    auto child = parent.With(PrioritySlot, 7);
+
+    ASSERT_NE(nullptr, child.Get(TraceSlot));
+    EXPECT_EQ("parent", *child.Get(TraceSlot));
+    EXPECT_EQ(7, *child.Get(PrioritySlot));
+    EXPECT_EQ(nullptr, parent.Get(PrioritySlot));
+    EXPECT_EQ(parent.Get(TraceSlot), child.Get(TraceSlot))
+        << "Untouched slots must be shared, not copied";
+}
+
+TEST(TaskContextTests, Task_WhenResumedOnOtherThread_SeesCreatorContext)
+{
+    auto task = []
+    {
+        Cortado::TaskContextScope scope{TraceSlot, "request-1"};
+        return ReadTraceInBackground();
+    }();
+
+    EXPECT_EQ("request-1", task.Get());
+    EXPECT_EQ(nullptr, TraceSlot.Get());
+}
+
+TEST(TaskContextTests, Child_WhenCreatedByTask_InheritsAndOverrides)
+{
+    auto parent = []() -> Task<std::string>
+    {
+        co_await Cortado::ResumeBackground();
+
+        auto inherited = ReadTraceInBackground();
+
+        auto overridden = []
+        {
+            Cortado::TaskContextScope scope{TraceSlot, "child"};
+            return ReadTraceInBackground();
+        }();
+
+        std::string first = co_await std::move(inherited);
+        std::string second = co_await std::move(overridden);
+
+        co_return first + "/" + second + "/" + *TraceSlot.Get();
+    };
+
+    auto task = [&]
+    {
+        Cortado::TaskContextScope scope{TraceSlot, "parent"};
+        return parent();
+    }();
+
+    EXPECT_EQ("parent/child/parent", task.Get());
+}
+
+TEST(TaskContextTests, Task_WhenCompleted_CallerContextRestored)
+{
+    Cortado::TaskContextScope scope{PrioritySlot, 1};
+
+    auto task = []() -> Task<>
+    {
+        Cortado::TaskContextScope inner{PrioritySlot, 2};
+        co_return;
+    };
+
+    task().Get();
+
+    ASSERT_NE(nullptr, PrioritySlot.Get());
+    EXPECT_EQ(1, *PrioritySlot.Get());
+}
@@ -0,0 +1,142 @@
+/// @file ThenTests.cpp
+/// Tests for Task::Then and Task::OnComplete.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+
+// STL
+//
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace
+{
+
+std::atomic_int g_allocations{0};
+std::atomic_int g_deallocations{0};
+
+struct CountingAllocator
+{
+    void *allocate(std::size_t size)
+    {
+        ++g_allocations;
+        return std::malloc(size);
+    }
+
+    void deallocate(void *ptr, std::size_t)
+    {
+        ++g_deallocations;
+        std::free(ptr);
+    }
+};
+
+struct CountingTaskImpl : Cortado::DefaultTaskImpl
+{
+    using Allocator = CountingAllocator;
+};
+
+template <typename T = void>
+using Task = Cortado::Task<T, CountingTaskImpl>;
+
+Task<int> Background(int value)
+{
+    co_await Cortado::ResumeBackground();
+    co_return value;
+}
+
+} // namespace
+
+TEST(ThenTests, Get_WhenThenAttached_ResultMapped)
+{
+    auto mapped = Background(21).Then([](int v) { return v * 2; });
+
+    EXPECT_EQ(42, mapped.Get());
+}
+
+TEST(ThenTests, CoAwait_WhenThenAttached_NoExtraFrame)
+{
+    auto parent = []() -> Task<std::string>
+    {
+        const int before = g_allocations;
+
+        auto text = co_await Background(7).Then([](int v)
+                                                { return std::to_string(v); });
+
+        EXPECT_EQ(before + 1, g_allocations.load())
+            << "Only the awaited coroutine itself is allocated";
+
+        co_return text;
+    };
+
+    EXPECT_EQ("7", parent().Get());
+}
+
+TEST(ThenTests, Then_WhenChainedThroughVoid_AllContinuationsRun)
+{
+    int seen = 0;
+
+    auto mapped = Background(5)
+                      .Then([&](int v) { seen = v; })
+                      .Then([&] { return seen + 1; });
+
+    EXPECT_EQ(6, mapped.Get());
+}
+
+TEST(ThenTests, Then_WhenTaskThrows_ContinuationSkipped)
+{
+    bool called = false;
+
+    auto failing = []() -> Task<int>
+    {
+        co_await Cortado::ResumeBackground();
+        throw std::runtime_error{"failed"};
+    };
+
+    auto mapped = failing().Then(
+        [&](int v)
+        {
+            called = true;
+            return v;
+        });
+
+    EXPECT_THROW(mapped.Get(), std::runtime_error);
+    EXPECT_FALSE(called);
+}
+
+TEST(ThenTests, OnComplete_WhenCoroutineRunning_CalledOnCompletion)
+{
+    std::promise<bool> called;
+    auto future = called.get_future();
+
+    Background(1).OnComplete([&] { called.set_value(true); });
+
+    EXPECT_TRUE(future.get());
+
+    // Frame is freed right after the callback returns, on the same thread.
+    //
+    for (int i = 0; i < 1000 && g_deallocations != g_allocations; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(g_allocations.load(), g_deallocations.load());
+}
+
+TEST(ThenTests, OnComplete_WhenAlreadyCompleted_CalledInPlace)
+{
+    bool called = false;
+
+    auto ready = []() -> Task<int> { co_return 1; };
+
+    ready().OnComplete([&] { called = true; });
+
+    EXPECT_TRUE(called);
+}
@@ -0,0 +1,155 @@
+/// @file ValueTaskTests.cpp
+/// Tests for Cortado::ValueTask.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/ValueTask.h>
+
+// STL
+//
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+
+std::atomic_int g_frameAllocations{0};
+
+struct CountingAllocator
+{
+    void *allocate(std::size_t size)
+    {
+        ++g_frameAllocations;
+        return std::malloc(size);
+    }
+
+    void deallocate(void *ptr, std::size_t)
+    {
+        std::free(ptr);
+    }
+};
+
+struct CountingTaskImpl : Cortado::DefaultTaskImpl
+{
+    using Allocator = CountingAllocator;
+};
+
+template <typename T = void>
+using Task = Cortado::Task<T, CountingTaskImpl>;
+
+template <typename T = void>
+using ValueTask = Cortado::ValueTask<T, CountingTaskImpl>;
+
+class Cache
+{
+public:
+    ValueTask<int> Lookup(int key)
+    {
+        if (auto it = m_values.find(key); it != m_values.end())
+        {
+            return ValueTask<int>::FromResult(it->second);
+        }
+
+        return Load(key);
+    }
+
+private:
+    Task<int> Load(int key)
+    {
+        co_await Cortado::ResumeBackground();
+        m_values[key] = key * 10;
+        co_return key * 10;
+    }
+
+    std::unordered_map<int, int> m_values;
+};
+
+} // namespace
+
+TEST(ValueTaskTests, Get_WhenFromResult_ReadyWithoutFrame)
+{
+    const int before = g_frameAllocations;
+
+    auto task = ValueTask<int>::FromResult(42);
+
+    EXPECT_TRUE(task.IsReady());
+    EXPECT_EQ(42, task.Get());
+    EXPECT_EQ(before, g_frameAllocations.load());
+}
+
+TEST(ValueTaskTests, CoAwait_WhenCacheHit_NoFrameAllocated)
+{
+    Cache cache;
+
+    auto sum = [](Cache &cache) -> Task<int>
+    {
+        int miss = co_await cache.Lookup(1);
+
+        const int before = g_frameAllocations;
+        int hit = co_await cache.Lookup(1);
+        EXPECT_EQ(before, g_frameAllocations.load())
+            << "Cache hit must not create a coroutine frame";
+
+        co_return miss + hit;
+    };
+
+    EXPECT_EQ(20, sum(cache).Get());
+}
+
+TEST(ValueTaskTests, Get_WhenCoroutine_WaitsForResult)
+{
+    Cache cache;
+
+    auto task = cache.Lookup(3);
+
+    EXPECT_EQ(30, task.Get());
+    EXPECT_TRUE(cache.Lookup(3).IsReady());
+}
+
+TEST(ValueTaskTests, CoAwait_WhenVoid_BothPathsComplete)
+{
+    std::atomic_int runs{0};
+
+    auto work = [](std::atomic_int &runs, bool ready) -> ValueTask<>
+    {
+        if (ready)
+        {
+            return ValueTask<>::FromResult();
+        }
+
+        return [](std::atomic_int &runs) -> Task<>
+        {
+            co_await Cortado::ResumeBackground();
+            ++runs;
+        }(runs);
+    };
+
+    auto parent = [&]() -> Task<>
+    {
+        co_await work(runs, true);
+        co_await work(runs, false);
+    };
+
+    parent().Get();
+
+    EXPECT_EQ(1, runs.load());
+}
+
+TEST(ValueTaskTests, CoAwait_WhenMoveOnlyResult_MovedOut)
+{
+    auto parent = []() -> Task<int>
+    {
+        auto ptr = co_await ValueTask<std::unique_ptr<int>>::FromResult(
+            std::make_unique<int>(7));
+        co_return *ptr;
+    };
+
+    EXPECT_EQ(7, parent().Get());
+}
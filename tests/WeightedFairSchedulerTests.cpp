@@ -0,0 +1,240 @@
+/// @file WeightedFairSchedulerTests.cpp
+/// Tests for Cortado::Common::WeightedFairCoroutineScheduler.
+///
+
+#include <gtest/gtest.h>
+
+// Cortado
+//
+#include <Cortado/Await.h>
+#include <Cortado/Common/WeightedFairCoroutineScheduler.h>
+
+// STL
+//
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+
+using Cortado::Common::TenantId;
+using Cortado::Common::TenantScope;
+using Cortado::Common::TenantTLS;
+using Scheduler = Cortado::Common::WeightedFairCoroutineScheduler;
+
+struct TenantTaskImpl :
+    Cortado::Common::STLAtomic,
+    Cortado::Common::STLCoroutineAllocator,
+    Cortado::Common::STLExceptionHandler,
+    Cortado::Common::TenantPreAndPostActions
+{
+    using Event = Cortado::DefaultEvent;
+};
+
+template <typename T = void>
+using Task = Cortado::Task<T, TenantTaskImpl>;
+
+/// @brief Records the order in which tenants' coroutines were resumed.
+///
+struct ResumeLog
+{
+    std::mutex Mutex;
+    std::vector<TenantId> Order;
+
+    void Push(TenantId tenant)
+    {
+        std::lock_guard lk{Mutex};
+        Order.push_back(tenant);
+    }
+};
+
+Task<> Blocker(Scheduler &sched, std::shared_future<void> gate)
+{
+    using Cortado::operator co_await;
+    co_await sched;
+    gate.wait();
+}
+
+Task<> Record(Scheduler &sched, ResumeLog &log)
+{
+    using Cortado::operator co_await;
+    co_await sched;
+    log.Push(TenantTLS::Get());
+}
+
+std::vector<Task<>> Spawn(
+    Scheduler &sched, ResumeLog &log, TenantId tenant, std::size_t count)
+{
+    TenantScope scope{tenant};
+
+    std::vector<Task<>> tasks;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        tasks.push_back(Record(sched, log));
+    }
+    return tasks;
+}
+
+} // namespace
+
+TEST(WeightedFairSchedulerTests, Schedule_WhenNoisyTenant_OthersInterleave)
+{
+    Scheduler sched{1};
+    ResumeLog log;
+
+    std::promise<void> release;
+    auto blocker = Blocker(sched, release.get_future().share());
+
+    auto noisy = Spawn(sched, log, 1, 20);
+    auto quiet = Spawn(sched, log, 2, 5);
+
+    release.set_value();
+
+    for (auto &t : noisy)
+    {
+        t.Wait();
+    }
+    for (auto &t : quiet)
+    {
+        t.Wait();
+    }
+
+    ASSERT_EQ(25u, log.Order.size());
+
+    auto lastQuiet = std::find(log.Order.rbegin(), log.Order.rend(), 2u);
+    auto lastQuietIndex = std::distance(lastQuiet, log.Order.rend()) - 1;
+    EXPECT_EQ(9, lastQuietIndex)
+        << "Equal weights must alternate tenants one by one";
+}
+
+TEST(WeightedFairSchedulerTests, Schedule_WhenWeighted_ShareIsProportional)
+{
+    Scheduler sched{1};
+    sched.SetWeight(1, 3);
+
+    ResumeLog log;
+
+    std::promise<void> release;
+    auto blocker = Blocker(sched, release.get_future().share());
+
+    auto heavy = Spawn(sched, log, 1, 12);
+    auto light = Spawn(sched, log, 2, 12);
+
+    release.set_value();
+
+    for (auto &t : heavy)
+    {
+        t.Wait();
+    }
+    for (auto &t : light)
+    {
+        t.Wait();
+    }
+
+    ASSERT_EQ(24u, log.Order.size());
+
+    std::vector<TenantId> expectedPrefix = {1, 1, 1, 2, 1, 1, 1, 2};
+    std::vector<TenantId> actualPrefix(log.Order.begin(),
+                                       log.Order.begin() + 8);
+    EXPECT_EQ(expectedPrefix, actualPrefix);
+}
+
+TEST(WeightedFairSchedulerTests, Tenant_WhenChildCreatedOnWorker_Inherited)
+{
+    Scheduler sched{2};
+
+    auto child = [](Scheduler &sched) -> Task<TenantId>
+    {
+        using Cortado::operator co_await;
+        co_await sched;
+        co_return TenantTLS::Get();
+    };
+
+    auto parent = [&](Scheduler &sched) -> Task<TenantId>
+    {
+        using Cortado::operator co_await;
+        co_await sched;
+
+        // Worker thread has never entered a TenantScope, the tenant comes
+        // from the parent's storage.
+        //
+        co_return co_await child(sched);
+    };
+
+    Task<TenantId> task = [&]
+    {
+        TenantScope scope{7};
+        return parent(sched);
+    }();
+
+    EXPECT_EQ(7u, task.Get());
+}
+
+TEST(WeightedFairSchedulerTests, Tenant_WhenCoroutineLeavesThread_Restored)
+{
+    using Event = Cortado::AsyncEvent<std::atomic_int64_t>;
+    Event event;
+
+    auto waiter = [](Event &event) -> Task<TenantId>
+    {
+        co_await event.WaitAsync();
+        co_return TenantTLS::Get();
+    };
+
+    Task<TenantId> task = [&]
+    {
+        TenantScope scope{7};
+        return waiter(event);
+    }();
+
+    EXPECT_EQ(0u, TenantTLS::Get());
+
+    // Resumes the coroutine inline on this thread.
+    //
+    event.Set();
+
+    EXPECT_EQ(7u, task.Get());
+    EXPECT_EQ(0u, TenantTLS::Get());
+}
+
+TEST(WeightedFairSchedulerTests, Post_WhenPostedFromJob_ChargedToJobsTenant)
+{
+    Scheduler sched{1};
+    std::promise<TenantId> tenant;
+
+    sched.Post(
+        [&]
+        {
+            sched.Post([&] { tenant.set_value(TenantTLS::Get()); });
+        },
+        5);
+
+    EXPECT_EQ(5u, tenant.get_future().get());
+}
+
+TEST(WeightedFairSchedulerTests, TenantCount_WhenDrained_UnweightedForgotten)
+{
+    constexpr TenantId TenantCount = 100;
+
+    Scheduler sched{1};
+    sched.SetWeight(TenantCount, 2);
+
+    std::vector<std::future<void>> done;
+    for (TenantId tenant = 0; tenant <= TenantCount; ++tenant)
+    {
+        auto ran = std::make_shared<std::promise<void>>();
+        done.push_back(ran->get_future());
+        sched.Post([ran] { ran->set_value(); }, tenant);
+    }
+
+    for (auto &f : done)
+    {
+        f.wait();
+    }
+
+    EXPECT_EQ(1u, sched.TenantCount()) << "Only the weighted tenant is kept";
+}